@@ -1,10 +1,13 @@
 #pragma once
 
+#include <array>
 #include <utility>
 #include "../natural/natural.hpp"
 #include "../integer/integer.hpp"
 #include "../numeric/rational.hpp"
 #include "../traits/traits.hpp"
+#include "../execution/execution.hpp"
+#include "power_cache.hpp"
 
 
 namespace big::algorithm
@@ -35,6 +38,97 @@ template <traits::polynomial_like T>
 	return first;
 }
 
+namespace detail
+{
+/**
+ * Checks whether the type has a multiplication member taking an execution policy.
+ */
+template <typename T>
+concept policy_multipliable = requires (T &a, const T &b, const execution::policy &policy)
+{
+	a.multiply(b, policy);
+};
+
+/**
+ * Checks whether the type has a long division member taking an execution policy.
+ */
+template <typename T>
+concept policy_divisible = requires (const T &a, const T &b, const execution::policy &policy)
+{
+	a.long_div(b, policy);
+};
+}
+
+/**
+ * Calculates the greatest common divisor of two values under the given execution policy.
+ *
+ * @tparam T Value type
+ *
+ * @param a      Polynomial-like
+ * @param b      Polynomial-like
+ * @param policy Execution policy of the divisions
+ *
+ * @return Greatest common divisor of `a` and `b`
+ */
+template <traits::polynomial_like T>
+[[nodiscard]] T gcd(const T &a, const T &b, const execution::policy &policy)
+{
+	execution::scoped_policy scope(policy);
+
+	if constexpr (detail::policy_divisible<T>)
+	{
+		T first(a);
+		T second(b);
+
+		while (!numeric::is_zero(second))
+		{
+			first = std::exchange(second, first.long_div(second, policy).second);
+		}
+
+		return first;
+	}
+	else
+	{
+		return gcd(a, b);
+	}
+}
+
+/**
+ * Divides one value by another, which is known to divide it.
+ *
+ * @tparam T Value type
+ *
+ * @param a Polynomial-like
+ * @param b Polynomial-like
+ *
+ * @return `a` divided by `b`
+ *
+ * @throws `std::domain_error` if `b` is zero
+ *
+ * @note The result is unspecified if `b` does not divide `a`.
+ *       Types other than natural and integer fall back to the regular division.
+ */
+template <traits::polynomial_like T>
+[[nodiscard]] constexpr T divexact(const T &a, const T &b)
+{
+	if constexpr (traits::natural_like<T>)
+	{
+		return a.divexact(b);
+	}
+	else
+	if constexpr (numeric::detail::member_abs<T> && numeric::detail::member_sign_bit<T>)
+	{
+		auto quotient = numeric::abs(a).divexact(numeric::abs(b));
+		const bool negative = !quotient.is_zero() && (numeric::sign_bit(a) ^ numeric::sign_bit(b));
+
+		return T(std::move(quotient), negative);
+	}
+	else
+	{
+		return a / b;
+	}
+}
+
 /**
  * Calculates the least common multiple of two values.
  *
@@ -50,8 +144,8 @@ template <traits::polynomial_like T>
 template <traits::polynomial_like T>
 [[nodiscard]] constexpr T lcm(const T &a, const T &b)
 {
-	T result = a * b;
-	result /= gcd(a, b);
+	T result = divexact(a, gcd(a, b));
+	result *= b;
 	return result;
 }
 
@@ -65,6 +159,8 @@ template <traits::polynomial_like T>
  * @param exp  Power exponent
  *
  * @return `base` raised to the power of `exp`
+ *
+ * @sa power_cache to share the powers of a small base between callers
  */
 template <traits::polynomial_like T, traits::integer_like U>
 [[nodiscard]] constexpr T pow(T base, U exp) noexcept
@@ -93,9 +189,80 @@ template <traits::polynomial_like T, traits::integer_like U>
 	return result;
 }
 
+/**
+ * Calculates the power of one value to the other under the given execution policy.
+ *
+ * @tparam T Base type
+ * @tparam U Exponent type
+ *
+ * @param base   Power base
+ * @param exp    Power exponent
+ * @param policy Execution policy of the multiplications
+ *
+ * @return `base` raised to the power of `exp`
+ */
+template <traits::polynomial_like T, traits::integer_like U>
+[[nodiscard]] T pow(T base, U exp, const execution::policy &policy)
+{
+	execution::scoped_policy scope(policy);
+
+	// naturals and integers pick the policy up as the default one of the thread
+	if constexpr (!detail::policy_multipliable<T> || traits::natural_like<T>)
+	{
+		return pow(std::move(base), std::move(exp));
+	}
+	else
+	{
+		auto result = numeric::multiplicative_identity<T>();
+
+		if (numeric::sign(exp) < 0)
+		{
+			return result / pow(std::move(base), numeric::abs(exp), policy);
+		}
+
+		while (!numeric::is_zero(exp))
+		{
+			if (numeric::abs(exp).is_even())
+			{
+				base.multiply(base, policy);
+				exp /= 2;
+			}
+			else
+			{
+				result.multiply(base, policy);
+				--exp;
+			}
+		}
+
+		return result;
+	}
+}
+
+namespace detail
+{
+/**
+ * Powers of ten that fit into a single digit of a natural number.
+ */
+inline constexpr auto powers_of_ten = []
+{
+	std::array<natural::digit_type, natural::bits_per_num> powers{1};
+
+	for (std::size_t i = 1; i < std::ranges::size(powers); ++i)
+	{
+		powers[i] = powers[i - 1] * 10;
+	}
+
+	return powers;
+}();
+}
+
 /**
  * Shifts the number to the left in decimal numeral system.
  *
+ * Whole digits of the number system are shifted, and the rest of the shift
+ * is done by a single-digit multiplication, so the cost is linear in the size
+ * of the result.
+ *
  * @tparam T Base type
  *
  * @param base Shift base
@@ -106,6 +273,59 @@ template <traits::polynomial_like T, traits::integer_like U>
 template <traits::rational_like T>
 [[nodiscard]] constexpr T decimal_shift(const T &base, std::size_t n)
 {
-	return base * pow(natural{10}, n);
+	if constexpr (traits::natural_like<T>)
+	{
+		T result(base);
+		result <<= n / natural::bits_per_num;
+		result.mul_digit(detail::powers_of_ten[n % natural::bits_per_num]);
+		return result;
+	}
+	else
+	if constexpr (numeric::detail::member_abs<T> && numeric::detail::member_sign_bit<T>)
+	{
+		return T(decimal_shift(numeric::abs(base), n), numeric::sign_bit(base));
+	}
+	else
+	{
+		return base * decimal_shift(natural{1}, n);
+	}
+}
+
+/**
+ * Shifts the number to the right in decimal numeral system.
+ *
+ * @tparam T Base type
+ *
+ * @param base Shift base
+ * @param n    Shift amount
+ *
+ * @return `base` divided by `10` to the power of `n`
+ *
+ * @note For natural and integer types the result is truncated towards zero.
+ *
+ * @sa decimal_shift
+ */
+template <traits::rational_like T>
+[[nodiscard]] constexpr T decimal_shift_right(const T &base, std::size_t n)
+{
+	if constexpr (traits::natural_like<T>)
+	{
+		T result(base);
+		result >>= n / natural::bits_per_num;
+		result.div_digit(detail::powers_of_ten[n % natural::bits_per_num]);
+		return result;
+	}
+	else
+	if constexpr (numeric::detail::member_abs<T> && numeric::detail::member_sign_bit<T>)
+	{
+		auto result = decimal_shift_right(numeric::abs(base), n);
+		const bool negative = !result.is_zero() && numeric::sign_bit(base);
+
+		return T(std::move(result), negative);
+	}
+	else
+	{
+		return base / decimal_shift(natural{1}, n);
+	}
 }
 }
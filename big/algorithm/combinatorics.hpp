@@ -0,0 +1,223 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include "algorithm.hpp"
+#include "reduce.hpp"
+#include "sieve.hpp"
+
+
+namespace big::algorithm
+{
+namespace detail
+{
+/**
+ * Collects small factors into digit-sized leaves of a product tree.
+ */
+class factor_collector
+{
+	std::vector<natural> leaves_;
+	std::uintmax_t current_ = 1;
+
+public:
+	/**
+	 * Multiplies the collected product by a power of a factor.
+	 *
+	 * @param factor Factor, expected to be below the number system base
+	 * @param exp    Power exponent
+	 */
+	void push(std::uintmax_t factor, std::size_t exp = 1)
+	{
+		for (std::size_t i = 0; i < exp; ++i)
+		{
+			if (current_ * factor >= natural::number_system_base)
+			{
+				leaves_.emplace_back(current_);
+				current_ = 1;
+			}
+
+			current_ *= factor;
+		}
+	}
+
+	/**
+	 * Multiplies the collected factors in a balanced tree.
+	 *
+	 * @return Product of the collected factors
+	 */
+	[[nodiscard]] natural product() &&
+	{
+		leaves_.emplace_back(current_);
+		return algorithm::product(std::move(leaves_));
+	}
+};
+
+/**
+ * Calculates the exponent of a prime in the factorial of a number (Legendre's formula).
+ *
+ * @param n     Number
+ * @param prime Prime
+ *
+ * @return Largest `e` such that `prime^e` divides `n!`
+ */
+[[nodiscard]] constexpr std::size_t factorial_exponent(std::size_t n, std::size_t prime) noexcept
+{
+	std::size_t exp = 0;
+
+	for (; n != 0; n /= prime)
+	{
+		exp += n / prime;
+	}
+
+	return exp;
+}
+
+/**
+ * Calculates the swinging factorial `n! / (n/2)!^2` from its prime factorization.
+ *
+ * @param n      Number
+ * @param primes Primes up to at least `n`, in ascending order
+ *
+ * @return Swinging factorial of `n`
+ */
+[[nodiscard]] inline natural swinging_factorial(std::size_t n, const std::vector<std::size_t> &primes)
+{
+	factor_collector factors;
+
+	for (const auto prime : primes)
+	{
+		if (prime > n)
+		{
+			break;
+		}
+
+		// every prime power in the swinging factorial is at most `n`
+		std::size_t power = 1;
+		for (auto q = n / prime; q != 0; q /= prime)
+		{
+			if (q % 2 != 0)
+			{
+				power *= prime;
+			}
+		}
+
+		if (power != 1)
+		{
+			factors.push(power);
+		}
+	}
+
+	return std::move(factors).product();
+}
+
+/**
+ * Calculates the factorial by the prime swing algorithm.
+ *
+ * @param n      Number
+ * @param primes Primes up to at least `n`, in ascending order
+ *
+ * @return `n!`
+ */
+[[nodiscard]] inline natural prime_swing_factorial(std::size_t n, const std::vector<std::size_t> &primes)
+{
+	if (n < 2)
+	{
+		return 1;
+	}
+
+	natural result = prime_swing_factorial(n / 2, primes);
+	result *= result;
+	result *= swinging_factorial(n, primes);
+
+	return result;
+}
+}
+
+/**
+ * Calculates the factorial of a number.
+ *
+ * `n! = (n/2)!^2 * swing(n)`, where the swinging factorial is assembled from
+ * its prime factorization in a balanced product tree, so that most of the work
+ * is done by large multiplications of similar-sized operands.
+ *
+ * @param n Number
+ *
+ * @return `n!`
+ */
+[[nodiscard]] inline natural factorial(std::size_t n)
+{
+	return detail::prime_swing_factorial(n, primes_up_to(n));
+}
+
+/**
+ * Calculates the binomial coefficient.
+ *
+ * The exponent of every prime is found by Legendre's formula, and
+ * the prime powers are multiplied in a balanced product tree.
+ *
+ * @param n Number of elements
+ * @param k Number of chosen elements
+ *
+ * @return `n` choose `k`, zero if `k > n`
+ */
+[[nodiscard]] inline natural binomial(std::size_t n, std::size_t k)
+{
+	if (k > n)
+	{
+		return {};
+	}
+
+	detail::factor_collector factors;
+
+	for (const auto prime : primes_up_to(n))
+	{
+		const auto exp = detail::factorial_exponent(n, prime)
+			- detail::factorial_exponent(k, prime)
+			- detail::factorial_exponent(n - k, prime);
+
+		factors.push(prime, exp);
+	}
+
+	return std::move(factors).product();
+}
+
+/**
+ * Calculates the multinomial coefficient.
+ *
+ * @param ks Sizes of the groups
+ *
+ * @return `(k_1 + ... + k_m)! / (k_1! * ... * k_m!)`
+ *
+ * @throws `std::overflow_error` if the sum of `ks` does not fit into `std::size_t`
+ *
+ * @sa binomial
+ */
+[[nodiscard]] inline natural multinomial(std::span<const std::size_t> ks)
+{
+	std::size_t n = 0;
+	for (const auto k : ks)
+	{
+		if (n > std::numeric_limits<std::size_t>::max() - k)
+		{
+			throw std::overflow_error("multinomial coefficient is too large");
+		}
+
+		n += k;
+	}
+
+	detail::factor_collector factors;
+
+	for (const auto prime : primes_up_to(n))
+	{
+		auto exp = detail::factorial_exponent(n, prime);
+		for (const auto k : ks)
+		{
+			exp -= detail::factorial_exponent(k, prime);
+		}
+
+		factors.push(prime, exp);
+	}
+
+	return std::move(factors).product();
+}
+}
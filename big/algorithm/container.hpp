@@ -11,13 +11,14 @@ namespace big::algorithm
  * Erases leading elements from back while given predicate is true.
  *
  * @tparam T	Vector value type
+ * @tparam Allocator Vector allocator type
  * @tparam UnaryPred Predicate type
  *
  * @param xs	Container
  * @param pred Unary predicate
  */
-template <typename T, typename UnaryPred>
-constexpr void erase_from_back_while(std::vector<T>& xs, const UnaryPred &pred) noexcept
+template <typename T, typename Allocator, typename UnaryPred>
+constexpr void erase_from_back_while(std::vector<T, Allocator>& xs, const UnaryPred &pred) noexcept
 {
 	namespace ranges = std::ranges;
 
@@ -48,15 +49,16 @@ constexpr void erase_from_back_while(std::vector<T>& xs, const UnaryPred &pred)
 /**
  * Shifts elements in array forward.
  *
- * @tparam T Vector value type
+ * @tparam T         Vector value type
+ * @tparam Allocator Vector allocator type
  *
  * @param xs Container
  * @param n  Shift amount
  *
  * @throws `std::length_error` if impossible to perform the shift
  */
-template <typename T>
-constexpr void shift_coefficients(std::vector<T>& xs, std::size_t n)
+template <typename T, typename Allocator>
+constexpr void shift_coefficients(std::vector<T, Allocator>& xs, std::size_t n)
 {
 	const auto size = std::ranges::size(xs);
 
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include "root.hpp"
+#include "sieve.hpp"
+
+
+namespace big::algorithm
+{
+namespace detail
+{
+/**
+ * Marks the quadratic residues modulo `M`.
+ */
+template <std::size_t M>
+inline constexpr auto square_residues = []
+{
+	std::array<bool, M> residues{};
+
+	for (std::size_t i = 0; i < M; ++i)
+	{
+		residues[i * i % M] = true;
+	}
+
+	return residues;
+}();
+
+/**
+ * Raises a machine word to the given power modulo `modulus`.
+ *
+ * @param base     Power base
+ * @param exp      Power exponent
+ * @param modulus  Modulus, expected to be below the number system base of natural
+ *
+ * @return `base^exp mod modulus`
+ */
+[[nodiscard]] constexpr std::uintmax_t pow_mod(std::uintmax_t base, std::uintmax_t exp, std::uintmax_t modulus) noexcept
+{
+	std::uintmax_t result = 1 % modulus;
+	base %= modulus;
+
+	for (; exp != 0; exp /= 2)
+	{
+		if (exp % 2 != 0)
+		{
+			result = result * base % modulus;
+		}
+
+		base = base * base % modulus;
+	}
+
+	return result;
+}
+
+/**
+ * Checks a natural number for being a square modulo 64, 63, 65 and 11.
+ *
+ * The residue modulo 64 is read off the lowest digit, and the rest
+ * are found with a single reduction modulo `63 * 65 * 11`.
+ *
+ * @param n Natural number
+ *
+ * @return `false` if `n` is certainly not a square, `true` otherwise
+ */
+[[nodiscard]] constexpr bool passes_square_filter(const natural &n)
+{
+	if (!square_residues<64>[n.digits().front() % 64])
+	{
+		return false;
+	}
+
+	const auto residue = n.mod_digit(63 * 65 * 11);
+
+	return square_residues<63>[residue % 63] && square_residues<65>[residue % 65] && square_residues<11>[residue % 11];
+}
+
+/**
+ * Checks a natural number for being a k-th power residue modulo several small primes.
+ *
+ * Only primes `q = 1 (mod k)` are used, since every residue is a k-th power otherwise.
+ * As many of them as fit into a single digit are reduced modulo at once.
+ *
+ * @param n Natural number
+ * @param k Power exponent
+ *
+ * @return `false` if `n` is certainly not a k-th power, `true` otherwise
+ */
+[[nodiscard]] constexpr bool passes_power_filter(const natural &n, std::size_t k)
+{
+	constexpr std::uintmax_t max_prime = 1 << 16;
+
+	std::uintmax_t modulus = 1;
+	std::array<std::uintmax_t, 8> primes{};
+	std::size_t count = 0;
+
+	for (std::uintmax_t q = k + 1; q < max_prime && count < std::ranges::size(primes); q += k)
+	{
+		if (!is_small_prime(q))
+		{
+			continue;
+		}
+
+		if (modulus * q >= natural::number_system_base)
+		{
+			break;
+		}
+
+		modulus *= q;
+		primes[count++] = q;
+	}
+
+	if (count == 0)
+	{
+		return true;
+	}
+
+	const auto residue = n.mod_digit(modulus);
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const auto q = primes[i];
+		const auto r = residue % q;
+
+		// Euler's criterion for k-th power residues
+		if (r != 0 && pow_mod(r, (q - 1) / k, q) != 1)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Finds an upper bound of the binary logarithm of a natural number.
+ *
+ * @param n Natural number
+ *
+ * @return Number of bits sufficient to store `n`
+ */
+[[nodiscard]] inline std::size_t bit_length_bound(const natural &n)
+{
+	const auto &digits = n.digits();
+	const auto size = std::ranges::size(digits);
+
+	return static_cast<std::size_t>((size - 1) * std::log2(natural::number_system_base) + std::log2(digits.back() + 1.0)) + 1;
+}
+
+/**
+ * Checks a natural number for being a k-th power.
+ *
+ * @param n Natural number
+ * @param k Power exponent
+ *
+ * @return `true` if `n` is a k-th power, `false` otherwise
+ */
+[[nodiscard]] inline bool is_natural_power(const natural &n, std::size_t k)
+{
+	if (k == 1 || n <= 1)
+	{
+		return true;
+	}
+
+	if (k % 2 == 0 && !passes_square_filter(n))
+	{
+		return false;
+	}
+
+	if (!passes_power_filter(n, k))
+	{
+		return false;
+	}
+
+	return pow(natural_root(n, k), k) == n;
+}
+}
+
+/**
+ * Checks the number for being a perfect square.
+ *
+ * Most non-squares are rejected by residues modulo small numbers,
+ * and the square root is only computed for the rest.
+ *
+ * @tparam T Value type
+ *
+ * @param n Integer-like
+ *
+ * @return `true` if `n` is a square of an integer, `false` otherwise
+ */
+template <traits::unbounded_integer_like T>
+[[nodiscard]] bool is_perfect_square(const T &n)
+{
+	if (numeric::sign_bit(n))
+	{
+		return false;
+	}
+
+	const auto &abs = numeric::abs(n);
+
+	return detail::passes_square_filter(abs) && sqrtrem(abs).second.is_zero();
+}
+
+/**
+ * Checks the number for being a perfect k-th power.
+ *
+ * @tparam T Value type
+ *
+ * @param n Integer-like
+ * @param k Power exponent
+ *
+ * @return `true` if `n` is a k-th power of an integer, `false` otherwise
+ *
+ * @throws `std::domain_error` if `k` is zero
+ */
+template <traits::unbounded_integer_like T>
+[[nodiscard]] bool is_perfect_power(const T &n, std::size_t k)
+{
+	if (k == 0)
+	{
+		throw std::domain_error("power of degree zero is undefined");
+	}
+
+	if (numeric::sign_bit(n) && k % 2 == 0)
+	{
+		return false;
+	}
+
+	return detail::is_natural_power(numeric::abs(n), k);
+}
+
+/**
+ * Checks the number for being a perfect power, i.e. a power of an integer with an exponent above one.
+ *
+ * Only prime exponents up to the binary logarithm of the number are tried,
+ * each of them behind the residue filters.
+ *
+ * @tparam T Value type
+ *
+ * @param n Integer-like
+ *
+ * @return `true` if `n` is a perfect power, `false` otherwise
+ *
+ * @note Zero and one are considered perfect powers.
+ */
+template <traits::unbounded_integer_like T>
+[[nodiscard]] bool is_perfect_power(const T &n)
+{
+	const bool negative = numeric::sign_bit(n);
+	const auto &abs = numeric::abs(n);
+
+	if (abs <= 1)
+	{
+		return true;
+	}
+
+	if (!negative && is_perfect_square(abs))
+	{
+		return true;
+	}
+
+	for (const auto prime : primes_up_to(detail::bit_length_bound(abs)))
+	{
+		if (prime != 2 && detail::is_natural_power(abs, prime))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+}
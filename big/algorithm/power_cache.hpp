@@ -0,0 +1,294 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "../natural/natural.hpp"
+
+
+namespace big::algorithm
+{
+/**
+ * Process-wide cache of the repeated squares `base^(2^k)` of single-digit bases.
+ *
+ * Every cached square is published through an atomic pointer and never changes
+ * afterwards, so lookups do not take any lock; only claiming a new base is
+ * serialized. The total size of the cached squares is bounded by a limit in
+ * digits, squares that do not fit are computed but not stored.
+ */
+class power_cache
+{
+public:
+	using digit_type = natural::digit_type;
+	using size_type = std::size_t;
+	using value_type = std::shared_ptr<const natural>;
+
+	static constexpr size_type max_bases = 16;
+	static constexpr size_type max_levels = 64;
+	static constexpr size_type default_limit = size_type{1} << 22;
+private:
+	/**
+	 * Squares of a single base, which stay accounted in the size of the cache until the table is destroyed.
+	 */
+	struct table
+	{
+		const digit_type base;
+		std::atomic<size_type> &size;
+		std::array<std::atomic<value_type>, max_levels> squares{};
+
+		table(digit_type base, std::atomic<size_type> &size) noexcept : base(base), size(size)
+		{
+		}
+
+		table(const table &) = delete;
+		table &operator=(const table &) = delete;
+
+		~table()
+		{
+			for (auto &slot : squares)
+			{
+				if (auto value = slot.load(std::memory_order_relaxed))
+				{
+					size.fetch_sub(std::ranges::size(value->digits()), std::memory_order_relaxed);
+				}
+			}
+		}
+	};
+
+	// declared before the tables, so that the tables can release their sizes when the cache is destroyed
+	std::atomic<size_type> size_{0};
+	std::array<std::atomic<std::shared_ptr<table>>, max_bases> tables_{};
+	std::atomic<size_type> limit_{default_limit};
+	std::mutex claim_mutex_;
+
+	/**
+	 * Finds the table of the given base, claiming a free one if there is none yet.
+	 *
+	 * @param base Power base
+	 *
+	 * @return Pointer to the table, `nullptr` if every table is claimed by other bases
+	 *
+	 * @note A table dropped by `clear` stays valid for the callers that still hold it.
+	 */
+	[[nodiscard]] std::shared_ptr<table> find_table(digit_type base)
+	{
+		for (const auto &slot : tables_)
+		{
+			auto entry = slot.load(std::memory_order_acquire);
+			if (entry == nullptr)
+			{
+				break;
+			}
+
+			if (entry->base == base)
+			{
+				return entry;
+			}
+		}
+
+		std::scoped_lock lock(claim_mutex_);
+
+		for (auto &slot : tables_)
+		{
+			auto entry = slot.load(std::memory_order_relaxed);
+			if (entry == nullptr)
+			{
+				entry = std::make_shared<table>(base, size_);
+				slot.store(entry, std::memory_order_release);
+				return entry;
+			}
+
+			if (entry->base == base)
+			{
+				return entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Publishes a square unless it would exceed the size limit.
+	 *
+	 * @param slot  Slot of the square
+	 * @param value Square
+	 *
+	 * @return The square that ended up in the slot or `value` if it was not stored
+	 */
+	[[nodiscard]] value_type publish(std::atomic<value_type> &slot, value_type value)
+	{
+		const auto size = std::ranges::size(value->digits());
+
+		auto current = size_.load(std::memory_order_relaxed);
+		do
+		{
+			if (current + size > limit_.load(std::memory_order_relaxed))
+			{
+				return value;
+			}
+		}
+		while (!size_.compare_exchange_weak(current, current + size, std::memory_order_relaxed));
+
+		value_type expected{};
+		if (!slot.compare_exchange_strong(expected, value, std::memory_order_acq_rel))
+		{
+			// another thread has published the same square first
+			size_.fetch_sub(size, std::memory_order_relaxed);
+			return expected;
+		}
+
+		return value;
+	}
+public:
+	[[nodiscard]] power_cache() = default;
+
+	power_cache(const power_cache &) = delete;
+	power_cache &operator=(const power_cache &) = delete;
+
+	/**
+	 * Gets the cache shared by the whole process.
+	 *
+	 * @return Reference to the global cache
+	 */
+	[[nodiscard]] static power_cache &global() noexcept
+	{
+		static power_cache cache;
+		return cache;
+	}
+
+	/**
+	 * Gets `base` raised to the power of `2^k`.
+	 *
+	 * @param base Power base
+	 * @param k    Logarithm of the exponent
+	 *
+	 * @return Shared pointer to `base^(2^k)`
+	 *
+	 * @throws `std::out_of_range` if `k` is not less than `max_levels`
+	 */
+	[[nodiscard]] value_type square(digit_type base, size_type k)
+	{
+		if (k >= max_levels)
+		{
+			throw std::out_of_range("power level " + std::to_string(k) + " is out of range");
+		}
+
+		if (base <= 1)
+		{
+			return std::make_shared<const natural>(base);
+		}
+
+		const auto entry = find_table(base);
+		if (entry == nullptr)
+		{
+			auto value = std::make_shared<natural>(base);
+			for (size_type i = 0; i < k; ++i)
+			{
+				*value *= *value;
+			}
+
+			return value;
+		}
+
+		auto &slot = entry->squares[k];
+		if (auto value = slot.load(std::memory_order_acquire))
+		{
+			return value;
+		}
+
+		if (k == 0)
+		{
+			return publish(slot, std::make_shared<const natural>(base));
+		}
+
+		const auto previous = square(base, k - 1);
+		return publish(slot, std::make_shared<const natural>(*previous * *previous));
+	}
+
+	/**
+	 * Raises a single-digit base to the given power using the cached squares.
+	 *
+	 * @param base Power base
+	 * @param exp  Power exponent
+	 *
+	 * @return `base` raised to the power of `exp`
+	 *
+	 * @throws `std::out_of_range` if `exp` has more than `max_levels` bits
+	 */
+	[[nodiscard]] natural power(digit_type base, natural exp)
+	{
+		natural result{1};
+
+		for (size_type k = 0; !exp.is_zero(); ++k)
+		{
+			if (!exp.is_even())
+			{
+				result *= *square(base, k);
+			}
+
+			exp.div_digit(2);
+		}
+
+		return result;
+	}
+
+	/**
+	 * Precomputes the squares `base^(2^i)` for every `i` up to `k`.
+	 *
+	 * @param base Power base
+	 * @param k    Logarithm of the largest exponent
+	 */
+	void warm_up(digit_type base, size_type k)
+	{
+		static_cast<void>(square(base, k));
+	}
+
+	/**
+	 * Drops every cached square and frees the tables claimed by their bases.
+	 *
+	 * @note Squares that are still referenced by callers stay alive until released.
+	 */
+	void clear()
+	{
+		std::scoped_lock lock(claim_mutex_);
+
+		for (auto &slot : tables_)
+		{
+			slot.store(nullptr, std::memory_order_release);
+		}
+	}
+
+	/**
+	 * Gets the total size of the cached squares.
+	 *
+	 * @return Size in digits
+	 */
+	[[nodiscard]] size_type size() const noexcept
+	{
+		return size_.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Gets the limit of the total size of the cached squares.
+	 *
+	 * @return Limit in digits
+	 */
+	[[nodiscard]] size_type limit() const noexcept
+	{
+		return limit_.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Sets the limit of the total size of the cached squares.
+	 *
+	 * @param digits Limit in digits
+	 *
+	 * @note Lowering the limit does not evict squares that are already cached.
+	 */
+	void set_limit(size_type digits) noexcept
+	{
+		limit_.store(digits, std::memory_order_relaxed);
+	}
+};
+}
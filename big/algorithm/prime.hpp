@@ -0,0 +1,575 @@
+#pragma once
+
+#include <atomic>
+#include <span>
+#include <vector>
+#include "perfect_power.hpp"
+#include "sieve.hpp"
+#include "../execution/execution.hpp"
+
+
+namespace big::algorithm
+{
+namespace detail
+{
+/**
+ * Modular arithmetic in Montgomery form.
+ *
+ * With `R = B^s`, where `B` is the number system base and `s` is the size of
+ * the modulus in digits, a residue `a` is stored as `a * R mod m`. Products are
+ * then reduced digit by digit from the least significant end, without any
+ * long division.
+ */
+class montgomery
+{
+	natural modulus_;
+	natural::digit_type inverse_;
+	natural one_;
+
+public:
+	/**
+	 * @param modulus Modulus, expected to be coprime with the number system base
+	 */
+	[[nodiscard]] explicit montgomery(const natural &modulus)
+		: modulus_(modulus)
+		, inverse_(natural::number_system_base - natural::inverse_digit(modulus.digits().front()))
+		, one_((natural(1) << size()) % modulus)
+	{}
+
+	/**
+	 * Gets the size of the modulus.
+	 *
+	 * @return Size in digits
+	 */
+	[[nodiscard]] std::size_t size() const noexcept
+	{
+		return std::ranges::size(modulus_.digits());
+	}
+
+	/**
+	 * Gets the modulus.
+	 *
+	 * @return Modulus
+	 */
+	[[nodiscard]] const natural &modulus() const noexcept
+	{
+		return modulus_;
+	}
+
+	/**
+	 * Gets the multiplicative identity in Montgomery form.
+	 *
+	 * @return `R mod m`
+	 */
+	[[nodiscard]] const natural &one() const noexcept
+	{
+		return one_;
+	}
+
+	/**
+	 * Converts a residue to Montgomery form.
+	 *
+	 * @param value Residue
+	 *
+	 * @return `value * R mod m`
+	 */
+	[[nodiscard]] natural to(const natural &value) const
+	{
+		return (value << size()) % modulus_;
+	}
+
+	/**
+	 * Converts a residue from Montgomery form.
+	 *
+	 * @param value Residue in Montgomery form
+	 *
+	 * @return `value / R mod m`
+	 */
+	[[nodiscard]] natural from(const natural &value) const
+	{
+		return reduce(value);
+	}
+
+	/**
+	 * Performs the Montgomery reduction.
+	 *
+	 * @param value Value below `m * R`
+	 *
+	 * @return `value / R mod m`
+	 */
+	[[nodiscard]] natural reduce(const natural &value) const
+	{
+		const auto size = this->size();
+		const auto &modulus = modulus_.digits();
+
+		natural::digits_type digits(value.digits());
+		digits.resize(2 * size + 1);
+
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			const std::uintmax_t factor = std::uintmax_t{digits[i]} * inverse_ % natural::number_system_base;
+			std::uintmax_t carry = 0;
+
+			for (std::size_t j = 0; j < size; ++j)
+			{
+				const auto current = factor * modulus[j] + digits[i + j] + carry;
+				digits[i + j] = current % natural::number_system_base;
+				carry = current / natural::number_system_base;
+			}
+
+			for (auto k = i + size; carry != 0; ++k)
+			{
+				const auto current = digits[k] + carry;
+				digits[k] = current % natural::number_system_base;
+				carry = current / natural::number_system_base;
+			}
+		}
+
+		digits.erase(std::ranges::begin(digits), std::ranges::next(std::ranges::begin(digits), size));
+
+		natural result(std::move(digits));
+		if (result >= modulus_)
+		{
+			result -= modulus_;
+		}
+
+		return result;
+	}
+
+	/**
+	 * Multiplies two residues in Montgomery form.
+	 */
+	[[nodiscard]] natural mul(const natural &a, const natural &b) const
+	{
+		return reduce(a * b);
+	}
+
+	/**
+	 * Adds two residues.
+	 */
+	[[nodiscard]] natural add(const natural &a, const natural &b) const
+	{
+		natural result = a + b;
+		if (result >= modulus_)
+		{
+			result -= modulus_;
+		}
+
+		return result;
+	}
+
+	/**
+	 * Subtracts two residues.
+	 */
+	[[nodiscard]] natural sub(const natural &a, const natural &b) const
+	{
+		if (a >= b)
+		{
+			return a - b;
+		}
+
+		natural result = a + modulus_;
+		result -= b;
+		return result;
+	}
+
+	/**
+	 * Halves a residue, the modulus is expected to be odd.
+	 */
+	[[nodiscard]] natural half(const natural &a) const
+	{
+		natural result(a);
+		if (!result.is_even())
+		{
+			result += modulus_;
+		}
+
+		result.div_digit(2);
+		return result;
+	}
+
+	/**
+	 * Raises a residue in Montgomery form to the given power.
+	 *
+	 * @param base Power base in Montgomery form
+	 * @param bits Power exponent bits, starting from the least significant one
+	 *
+	 * @return `base^exp` in Montgomery form
+	 */
+	[[nodiscard]] natural pow(const natural &base, const std::vector<bool> &bits) const
+	{
+		natural result = one_;
+
+		for (const bool bit : bits | std::views::reverse)
+		{
+			result = mul(result, result);
+
+			if (bit)
+			{
+				result = mul(result, base);
+			}
+		}
+
+		return result;
+	}
+};
+
+/**
+ * Converts a natural number to binary.
+ *
+ * @param n Natural number
+ *
+ * @return Bits of `n`, starting from the least significant one
+ */
+[[nodiscard]] inline std::vector<bool> to_bits(natural n)
+{
+	constexpr std::size_t chunk_bits = 29;
+
+	std::vector<bool> bits;
+
+	while (!n.is_zero())
+	{
+		auto chunk = n.div_digit(natural::digit_type{1} << chunk_bits);
+
+		for (std::size_t i = 0; i < chunk_bits; ++i, chunk >>= 1)
+		{
+			bits.push_back(chunk & 1);
+		}
+	}
+
+	while (!bits.empty() && !bits.back())
+	{
+		bits.pop_back();
+	}
+
+	return bits;
+}
+
+/**
+ * Splits an even number into an odd part and a power of two.
+ *
+ * @param bits Bits of the number, starting from the least significant one
+ *
+ * @return Number of trailing zero bits, the bits are shifted right by that amount
+ */
+[[nodiscard]] inline std::size_t remove_trailing_zero_bits(std::vector<bool> &bits)
+{
+	const auto zeroes = static_cast<std::size_t>(std::ranges::distance(std::ranges::begin(bits), std::ranges::find(bits, true)));
+	bits.erase(std::ranges::begin(bits), std::ranges::next(std::ranges::begin(bits), zeroes));
+	return zeroes;
+}
+
+/**
+ * Calculates the Jacobi symbol of two machine words.
+ *
+ * @param a Numerator
+ * @param n Denominator, expected to be odd
+ *
+ * @return Jacobi symbol `(a/n)`
+ */
+[[nodiscard]] constexpr int jacobi(std::uintmax_t a, std::uintmax_t n) noexcept
+{
+	int result = 1;
+	a %= n;
+
+	while (a != 0)
+	{
+		while (a % 2 == 0)
+		{
+			a /= 2;
+			if (n % 8 == 3 || n % 8 == 5)
+			{
+				result = -result;
+			}
+		}
+
+		std::swap(a, n);
+		if (a % 4 == 3 && n % 4 == 3)
+		{
+			result = -result;
+		}
+
+		a %= n;
+	}
+
+	return n == 1 ? result : 0;
+}
+
+/**
+ * Calculates the Jacobi symbol of a small signed number over a natural number.
+ *
+ * @param d Numerator
+ * @param n Denominator, expected to be odd
+ *
+ * @return Jacobi symbol `(d/n)`
+ */
+[[nodiscard]] inline int jacobi(std::intmax_t d, const natural &n)
+{
+	const auto abs = static_cast<std::uintmax_t>(d < 0 ? -d : d);
+
+	// n mod 4 is read off the lowest digit, since 4 divides the base
+	const auto n_mod_4 = n.digits().front() % 4;
+
+	// (|d|/n) = (n mod |d| / |d|) by the reciprocity law, up to the sign
+	int result = jacobi(n.mod_digit(abs), abs);
+	if (abs % 4 == 3 && n_mod_4 == 3)
+	{
+		result = -result;
+	}
+
+	if (d < 0 && n_mod_4 == 3)
+	{
+		result = -result;
+	}
+
+	return result;
+}
+
+/**
+ * Odd primes used for trial division, grouped so that the product of each group fits into a digit.
+ */
+inline const std::vector<std::vector<natural::digit_type>> &trial_division_groups()
+{
+	static const auto groups = []
+	{
+		constexpr std::size_t trial_division_limit = 1000;
+
+		std::vector<std::vector<natural::digit_type>> groups;
+		std::uintmax_t product = natural::number_system_base;
+
+		for (const auto prime : primes_up_to(trial_division_limit))
+		{
+			if (prime == 2)
+			{
+				continue;
+			}
+
+			if (product * prime >= natural::number_system_base)
+			{
+				groups.emplace_back();
+				product = 1;
+			}
+
+			groups.back().push_back(prime);
+			product *= prime;
+		}
+
+		return groups;
+	}();
+
+	return groups;
+}
+}
+
+/**
+ * Checks an odd number for being a strong probable prime to the given base (Miller-Rabin test).
+ *
+ * @param n    Natural number, expected to be odd, coprime with the number system base and greater than `base`
+ * @param base Witness base
+ *
+ * @return `false` if `n` is certainly composite, `true` otherwise
+ */
+[[nodiscard]] inline bool is_strong_probable_prime(const natural &n, const natural &base)
+{
+	const detail::montgomery ring(n);
+	const auto minus_one = ring.sub(natural{}, ring.one());
+
+	auto bits = detail::to_bits(n - 1);
+	const auto zeroes = detail::remove_trailing_zero_bits(bits);
+
+	auto x = ring.pow(ring.to(base), bits);
+	if (x == ring.one() || x == minus_one)
+	{
+		return true;
+	}
+
+	for (std::size_t i = 1; i < zeroes; ++i)
+	{
+		x = ring.mul(x, x);
+		if (x == minus_one)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Checks an odd number for being a strong Lucas probable prime.
+ *
+ * The parameters are chosen by Selfridge's method: `D` is the first of
+ * `5, -7, 9, -11, ...` with the Jacobi symbol `(D/n) = -1`, `P = 1` and
+ * `Q = (1 - D) / 4`.
+ *
+ * @param n Natural number, expected to be odd and coprime with the number system base
+ *
+ * @return `false` if `n` is certainly composite, `true` otherwise
+ */
+[[nodiscard]] inline bool is_strong_lucas_probable_prime(const natural &n)
+{
+	std::intmax_t d = 5;
+	for (;; d = d > 0 ? -(d + 2) : -d + 2)
+	{
+		const auto symbol = detail::jacobi(d, n);
+		if (symbol == -1)
+		{
+			break;
+		}
+
+		if (symbol == 0 && n != static_cast<std::uintmax_t>(d < 0 ? -d : d))
+		{
+			return false;
+		}
+
+		// there is no such D for squares
+		if (d == 13 && is_perfect_square(n))
+		{
+			return false;
+		}
+	}
+
+	const detail::montgomery ring(n);
+
+	const auto to_residue = [&](std::intmax_t value)
+	{
+		const auto residue = ring.to(natural(static_cast<std::uintmax_t>(value < 0 ? -value : value)));
+		return value < 0 ? ring.sub(natural{}, residue) : residue;
+	};
+
+	const auto discriminant = to_residue(d);
+	const auto q = to_residue((1 - d) / 4);
+
+	auto bits = detail::to_bits(n + 1);
+	const auto zeroes = detail::remove_trailing_zero_bits(bits);
+
+	// U_1 = 1, V_1 = P = 1, Q^1 = Q
+	auto u = ring.one();
+	auto v = ring.one();
+	auto q_power = q;
+
+	for (const bool bit : bits | std::views::reverse | std::views::drop(1))
+	{
+		// U_2k = U_k V_k, V_2k = V_k^2 - 2 Q^k
+		u = ring.mul(u, v);
+		v = ring.sub(ring.mul(v, v), ring.add(q_power, q_power));
+		q_power = ring.mul(q_power, q_power);
+
+		if (bit)
+		{
+			// U_k+1 = (P U_k + V_k) / 2, V_k+1 = (D U_k + P V_k) / 2
+			auto next_u = ring.half(ring.add(u, v));
+			v = ring.half(ring.add(ring.mul(discriminant, u), v));
+			u = std::move(next_u);
+			q_power = ring.mul(q_power, q);
+		}
+	}
+
+	if (u.is_zero() || v.is_zero())
+	{
+		return true;
+	}
+
+	for (std::size_t i = 1; i < zeroes; ++i)
+	{
+		v = ring.sub(ring.mul(v, v), ring.add(q_power, q_power));
+		if (v.is_zero())
+		{
+			return true;
+		}
+
+		q_power = ring.mul(q_power, q_power);
+	}
+
+	return false;
+}
+
+/**
+ * Checks the number for being a probable prime (Baillie-PSW test).
+ *
+ * The number is trial divided by the primes below 1000 first. The survivors
+ * go through the strong base-2 Miller-Rabin test and the strong Lucas test,
+ * both in Montgomery arithmetic. No composite number passing both of them
+ * is known.
+ *
+ * @tparam T Value type
+ *
+ * @param n Integer-like
+ *
+ * @return `false` if `n` is certainly not a prime, `true` if `n` is a probable prime
+ *
+ * @note Numbers below two, including the negative ones, are not primes.
+ */
+template <traits::unbounded_integer_like T>
+[[nodiscard]] bool is_probable_prime(const T &n)
+{
+	if (numeric::sign_bit(n))
+	{
+		return false;
+	}
+
+	const natural &abs = numeric::abs(n);
+
+	// below the square of the trial division limit the trial division is conclusive
+	constexpr std::uintmax_t small_limit = 1'000'000;
+	if (abs < small_limit)
+	{
+		return is_small_prime(static_cast<std::uintmax_t>(abs));
+	}
+
+	if (abs.is_even())
+	{
+		return false;
+	}
+
+	for (const auto &group : detail::trial_division_groups())
+	{
+		std::uintmax_t product = 1;
+		for (const auto prime : group)
+		{
+			product *= prime;
+		}
+
+		const auto residue = abs.mod_digit(product);
+		for (const auto prime : group)
+		{
+			if (residue % prime == 0)
+			{
+				return false;
+			}
+		}
+	}
+
+	return is_strong_probable_prime(abs, 2)
+		&& !is_perfect_square(abs)
+		&& is_strong_lucas_probable_prime(abs);
+}
+
+/**
+ * Checks many numbers for being probable primes on multiple threads.
+ *
+ * @param candidates Numbers to check
+ * @param policy     Execution policy
+ *
+ * @return Results of `is_probable_prime` in the order of `candidates`
+ */
+[[nodiscard]] inline std::vector<bool> batch_is_probable_prime(std::span<const natural> candidates,
+	const execution::policy &policy = execution::default_policy())
+{
+	std::vector<char> results(std::ranges::size(candidates));
+	std::atomic<std::size_t> next{0};
+
+	// candidates differ in cost a lot, so they are handed out one by one rather than in fixed chunks
+	const auto workers = std::min(policy.concurrency(), std::ranges::size(candidates));
+
+	execution::parallel_for(policy, workers, 1, [&](std::size_t, std::size_t)
+	{
+		for (auto i = next++; i < std::ranges::size(candidates); i = next++)
+		{
+			results[i] = is_probable_prime(candidates[i]);
+		}
+	});
+
+	return {std::ranges::begin(results), std::ranges::end(results)};
+}
+}
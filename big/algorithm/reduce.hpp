@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <ranges>
+#include <span>
+#include <vector>
+#include "algorithm.hpp"
+#include "../execution/execution.hpp"
+#include "../memory/allocator.hpp"
+
+
+namespace big::algorithm
+{
+/**
+ * Smallest total number of limbs of the values multiplied on one thread by `product`.
+ */
+inline constexpr std::size_t parallel_product_threshold = 1024;
+
+/**
+ * Smallest total number of limbs of the values added on one thread by `sum`.
+ */
+inline constexpr std::size_t parallel_sum_threshold = 1 << 16;
+
+namespace detail
+{
+/**
+ * Estimates the work of an operation on a value by the number of its limbs.
+ *
+ * @tparam T Value type
+ *
+ * @param value Natural-like, integer-like, rational-like, polynomial or fraction
+ *
+ * @return Total number of limbs of the numbers the value consists of, `1` for other types
+ */
+template <typename T>
+[[nodiscard]] constexpr std::size_t limb_count(const T &value)
+{
+	if constexpr (requires { value.digits(); })
+	{
+		return std::ranges::size(value.digits());
+	}
+	else
+	if constexpr (requires { value.abs().digits(); })
+	{
+		return limb_count(value.abs());
+	}
+	else
+	if constexpr (numeric::rational::detail::member_denominator<T>)
+	{
+		return limb_count(value.numerator()) + limb_count(value.denominator());
+	}
+	else
+	if constexpr (requires { value.coefficients(); })
+	{
+		std::size_t count = 0;
+
+		for (const auto &coefficient : value.coefficients())
+		{
+			count += limb_count(coefficient);
+		}
+
+		return count;
+	}
+	else
+	if constexpr (requires { value.first; value.second; })
+	{
+		return limb_count(value.first) + limb_count(value.second);
+	}
+	else
+	{
+		return 1;
+	}
+}
+
+/**
+ * Reduces values in a balanced binary tree.
+ *
+ * @tparam T        Value type
+ * @tparam BinaryOp Operation type
+ *
+ * @param values Values, expected to be nonempty, are consumed
+ * @param op     Associative operation
+ *
+ * @return Reduction of `values`
+ */
+template <typename T, typename BinaryOp>
+[[nodiscard]] T reduce_balanced(std::span<T> values, const BinaryOp &op)
+{
+	// neighbouring values are combined, so every level works on operands of similar size
+	for (auto size = std::ranges::size(values); size > 1; size = (size + 1) / 2)
+	{
+		for (std::size_t i = 0; i < size / 2; ++i)
+		{
+			values[i] = op(std::move(values[2 * i]), std::move(values[2 * i + 1]));
+		}
+
+		if (size % 2 != 0)
+		{
+			values[size / 2] = std::move(values[size - 1]);
+		}
+	}
+
+	return std::move(values.front());
+}
+
+/**
+ * Reduces values in a balanced binary tree, the subtrees of which are run on the threads of a pool.
+ *
+ * @tparam T        Value type
+ * @tparam BinaryOp Operation type
+ *
+ * @param values   Values
+ * @param op       Associative operation
+ * @param identity Identity of `op`, returned for empty `values`
+ * @param policy   Execution policy
+ * @param grain    Smallest total number of limbs of the values of a subtree run on its own thread
+ *
+ * @return Reduction of `values`
+ */
+template <typename T, typename BinaryOp>
+[[nodiscard]] T reduce_tree(std::vector<T> values, const BinaryOp &op, T identity, const execution::policy &policy, std::size_t grain)
+{
+	const auto size = std::ranges::size(values);
+
+	if (size == 0)
+	{
+		return identity;
+	}
+
+	std::size_t limbs = 0;
+	for (const auto &value : values)
+	{
+		limbs += limb_count(value);
+	}
+
+	// a subtree below the grain costs less than handing it to another thread
+	const auto chunks = std::min({policy.concurrency(), size, std::max<std::size_t>(limbs / std::max<std::size_t>(grain, 1), 1)});
+	if (chunks == 1)
+	{
+		execution::scoped_policy scope(policy);
+		return reduce_balanced(std::span(values), op);
+	}
+
+	auto partial = memory::make_unscoped<std::vector<T>>(chunks);
+
+	execution::parallel_for(policy, chunks, 1, [&](std::size_t first, std::size_t last)
+	{
+		for (auto chunk = first; chunk < last; ++chunk)
+		{
+			const auto begin = size * chunk / chunks;
+			const auto end = size * (chunk + 1) / chunks;
+
+			// the values may be bound to a scoped resource of the calling thread, so they are reduced in copies
+			std::vector<T> local(std::ranges::begin(values) + begin, std::ranges::begin(values) + end);
+			partial[chunk] = reduce_balanced(std::span(local), op);
+		}
+	});
+
+	execution::scoped_policy scope(policy);
+	return reduce_balanced(std::span(partial), op);
+}
+
+/**
+ * Unsimplified fraction, used to postpone simplification of rational reductions to the very end.
+ */
+using fraction = std::pair<integer, natural>;
+
+/**
+ * Collects the values of a range into a vector, reusing the storage of a vector rvalue.
+ */
+template <typename T, std::ranges::input_range R>
+[[nodiscard]] std::vector<T> to_vector(R &&range)
+{
+	if constexpr (std::same_as<std::remove_cvref_t<R>, std::vector<T>> && !std::is_lvalue_reference_v<R>)
+	{
+		return std::move(range);
+	}
+	else
+	{
+		return std::vector<T>(std::ranges::begin(range), std::ranges::end(range));
+	}
+}
+
+/**
+ * Converts the values of a range into unsimplified fractions.
+ */
+template <std::ranges::input_range R>
+[[nodiscard]] std::vector<fraction> to_fractions(R &&range)
+{
+	std::vector<fraction> fractions;
+
+	for (const auto &value : range)
+	{
+		fractions.emplace_back(numeric::rational::numerator(value), numeric::rational::denominator(value));
+	}
+
+	return fractions;
+}
+}
+
+/**
+ * Calculates the product of a range of values.
+ *
+ * The values are multiplied in a balanced tree rather than folded from the left,
+ * so that the operands of every multiplication are of similar size. Rationals have
+ * their numerators and denominators multiplied separately and are simplified once.
+ * The values run on a single thread unless they have at least
+ * `parallel_product_threshold` limbs for every thread.
+ *
+ * @tparam R Range type
+ *
+ * @param range   Polynomial-likes
+ * @param policy  Execution policy to run the subtrees under
+ *
+ * @return Product of `range`, the multiplicative identity if `range` is empty
+ */
+template <std::ranges::input_range R>
+	requires traits::polynomial_like<std::ranges::range_value_t<R>>
+[[nodiscard]] auto product(R &&range, const execution::policy &policy = execution::default_policy())
+{
+	using T = std::remove_cvref_t<std::ranges::range_value_t<R>>;
+
+	if constexpr (numeric::rational::detail::member_denominator<T>)
+	{
+		const auto multiply = [](detail::fraction a, const detail::fraction &b)
+		{
+			a.first *= b.first;
+			a.second *= b.second;
+			return a;
+		};
+
+		auto [numerator, denominator] = detail::reduce_tree(detail::to_fractions(range), multiply, detail::fraction{1, 1}, policy, parallel_product_threshold);
+		return T(numerator, denominator);
+	}
+	else
+	{
+		const auto multiply = [](T a, const T &b)
+		{
+			a *= b;
+			return a;
+		};
+
+		return detail::reduce_tree(detail::to_vector<T>(std::forward<R>(range)), multiply, numeric::multiplicative_identity<T>(), policy, parallel_product_threshold);
+	}
+}
+
+/**
+ * Calculates the sum of a range of values.
+ *
+ * The values are added in a balanced tree. Rationals are added as fractions
+ * over the product of the denominators and are simplified once. The values run on
+ * a single thread unless they have at least `parallel_sum_threshold` limbs for every thread.
+ *
+ * @tparam R Range type
+ *
+ * @param range   Polynomial-likes
+ * @param policy  Execution policy to run the subtrees under
+ *
+ * @return Sum of `range`, zero if `range` is empty
+ */
+template <std::ranges::input_range R>
+	requires traits::polynomial_like<std::ranges::range_value_t<R>>
+[[nodiscard]] auto sum(R &&range, const execution::policy &policy = execution::default_policy())
+{
+	using T = std::remove_cvref_t<std::ranges::range_value_t<R>>;
+
+	if constexpr (numeric::rational::detail::member_denominator<T>)
+	{
+		const auto add = [](detail::fraction a, const detail::fraction &b)
+		{
+			if (a.second == b.second)
+			{
+				a.first += b.first;
+				return a;
+			}
+
+			a.first *= b.second;
+			a.first += b.first * a.second;
+			a.second *= b.second;
+			return a;
+		};
+
+		auto [numerator, denominator] = detail::reduce_tree(detail::to_fractions(range), add, detail::fraction{0, 1}, policy, parallel_sum_threshold);
+		return T(numerator, denominator);
+	}
+	else
+	{
+		const auto add = [](T a, const T &b)
+		{
+			a += b;
+			return a;
+		};
+
+		return detail::reduce_tree(detail::to_vector<T>(std::forward<R>(range)), add, T{}, policy, parallel_sum_threshold);
+	}
+}
+}
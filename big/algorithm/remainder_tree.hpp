@@ -0,0 +1,149 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include "algorithm.hpp"
+
+
+namespace big::algorithm
+{
+/**
+ * Builds the product tree of the values.
+ *
+ * Every node is the product of its two children, and an unpaired node
+ * is carried to the next level as it is.
+ *
+ * @param values Leaves of the tree
+ *
+ * @return Levels of the tree, starting from the leaves and ending with the root,
+ *         empty if `values` is empty
+ */
+[[nodiscard]] inline std::vector<std::vector<natural>> product_tree(std::span<const natural> values)
+{
+	std::vector<std::vector<natural>> levels;
+
+	if (std::ranges::empty(values))
+	{
+		return levels;
+	}
+
+	levels.emplace_back(std::ranges::begin(values), std::ranges::end(values));
+
+	while (std::ranges::size(levels.back()) > 1)
+	{
+		const auto &previous = levels.back();
+		const auto size = std::ranges::size(previous);
+
+		std::vector<natural> level;
+		level.reserve((size + 1) / 2);
+
+		for (std::size_t i = 0; i + 1 < size; i += 2)
+		{
+			level.push_back(previous[i] * previous[i + 1]);
+		}
+
+		if (size % 2 != 0)
+		{
+			level.push_back(previous.back());
+		}
+
+		levels.push_back(std::move(level));
+	}
+
+	return levels;
+}
+
+namespace detail
+{
+/**
+ * Reduces a value modulo every node of a tree, descending from the root.
+ *
+ * @param value  Value
+ * @param levels Levels of the tree, starting from the leaves
+ *
+ * @return `value` modulo every leaf
+ */
+[[nodiscard]] inline std::vector<natural> descend(const natural &value, const std::vector<std::vector<natural>> &levels)
+{
+	std::vector<natural> remainders{value % levels.back().front()};
+
+	for (const auto &level : levels | std::views::reverse | std::views::drop(1))
+	{
+		std::vector<natural> next;
+		next.reserve(std::ranges::size(level));
+
+		for (std::size_t i = 0; i < std::ranges::size(level); ++i)
+		{
+			next.push_back(remainders[i / 2] % level[i]);
+		}
+
+		remainders = std::move(next);
+	}
+
+	return remainders;
+}
+}
+
+/**
+ * Reduces a value modulo many moduli at once.
+ *
+ * The value is reduced modulo the product of all moduli first, and the
+ * remainders are then pushed down the product tree, so that each level
+ * costs about as much as a single division of the size of the root.
+ *
+ * @param value   Value
+ * @param moduli  Moduli, expected to be nonzero
+ *
+ * @return `value mod m` for every `m` in `moduli`, in the same order
+ */
+[[nodiscard]] inline std::vector<natural> remainder_tree(const natural &value, std::span<const natural> moduli)
+{
+	if (std::ranges::empty(moduli))
+	{
+		return {};
+	}
+
+	return detail::descend(value, product_tree(moduli));
+}
+
+/**
+ * Finds the factors that every value shares with the rest of the values (Bernstein's batch GCD).
+ *
+ * With `P` being the product of all values, `P mod x^2` is found for every `x`
+ * by descending the tree of squares, and the result is `gcd(x, (P mod x^2) / x)`.
+ *
+ * @param values Values, expected to be nonzero
+ *
+ * @return `gcd(x_i, product of x_j for j != i)` for every `x_i` in `values`, in the same order
+ */
+[[nodiscard]] inline std::vector<natural> batch_gcd(std::span<const natural> values)
+{
+	if (std::ranges::empty(values))
+	{
+		return {};
+	}
+
+	auto levels = product_tree(values);
+	const auto root = levels.back().front();
+
+	for (auto &level : levels)
+	{
+		for (auto &node : level)
+		{
+			node *= node;
+		}
+	}
+
+	const auto remainders = detail::descend(root, levels);
+
+	std::vector<natural> result;
+	result.reserve(std::ranges::size(values));
+
+	for (std::size_t i = 0; i < std::ranges::size(values); ++i)
+	{
+		result.push_back(gcd(values[i], divexact(remainders[i], values[i])));
+	}
+
+	return result;
+}
+}
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <cmath>
+#include <stdexcept>
+#include "algorithm.hpp"
+
+
+namespace big::algorithm
+{
+namespace detail
+{
+/**
+ * Checks whether a value raised to the given power does not exceed the limit.
+ *
+ * @param value Power base
+ * @param k     Power exponent
+ * @param limit Limit
+ *
+ * @return `true` if `value^k <= limit`, `false` otherwise
+ */
+[[nodiscard]] constexpr bool power_fits(std::uintmax_t value, std::size_t k, std::uintmax_t limit) noexcept
+{
+	std::uintmax_t power = 1;
+
+	for (std::size_t i = 0; i < k; ++i)
+	{
+		if (value != 0 && power > limit / value)
+		{
+			return false;
+		}
+
+		power *= value;
+	}
+
+	return power <= limit;
+}
+
+/**
+ * Calculates the integer k-th root of a machine word.
+ *
+ * @param value Radicand
+ * @param k     Root degree
+ *
+ * @return Largest `r` such that `r^k <= value`
+ */
+[[nodiscard]] inline std::uintmax_t small_root(std::uintmax_t value, std::size_t k) noexcept
+{
+	if (value < 2 || k == 1)
+	{
+		return value;
+	}
+
+	auto root = static_cast<std::uintmax_t>(std::pow(static_cast<long double>(value), 1.0L / k));
+
+	while (root > 0 && !power_fits(root, k, value))
+	{
+		--root;
+	}
+
+	while (power_fits(root + 1, k, value))
+	{
+		++root;
+	}
+
+	return root;
+}
+
+/**
+ * Estimates the k-th root of a natural number of at least three digits from above.
+ *
+ * The decimal logarithm of the number is bounded from above by its two most
+ * significant digits, and the root is built from a floating-point mantissa
+ * of at most 18 decimal digits, rounded up, and a power of ten.
+ *
+ * @param n Radicand of at least three digits
+ * @param k Root degree
+ *
+ * @return Overestimate of the root, accurate to about twelve decimal digits
+ */
+[[nodiscard]] inline natural root_estimate(const natural &n, std::size_t k)
+{
+	constexpr long double base = natural::number_system_base;
+	constexpr std::size_t mantissa_digits = 18;
+
+	const auto &digits = n.digits();
+	const auto size = std::ranges::size(digits);
+
+	const long double top = digits[size - 1] * base + digits[size - 2] + 1;
+	const long double log = std::log10(top) + static_cast<long double>(natural::bits_per_num * (size - 2));
+	const long double root_log = log / static_cast<long double>(k);
+
+	const auto exponent = root_log < mantissa_digits ? std::size_t{0} : static_cast<std::size_t>(root_log) - (mantissa_digits - 1);
+	const long double mantissa = std::pow(10.0L, root_log - static_cast<long double>(exponent));
+
+	// the margin covers the rounding errors of the logarithm and the power
+	return decimal_shift(natural(static_cast<std::uintmax_t>(std::ceil(mantissa * (1 + 1e-12L))) + 1), exponent);
+}
+
+/**
+ * Calculates the integer k-th root of a natural number.
+ *
+ * The root of the number without its lowest digits is found recursively,
+ * which gives an overestimate accurate to about half of the digits of the
+ * result. Roots of fewer than four digits are estimated in floating point
+ * instead, as the recursion would lose all of their precision. Newton
+ * iteration then converges from above within a couple of steps, each
+ * doubling the precision.
+ *
+ * @param n Radicand
+ * @param k Root degree
+ *
+ * @return Largest `r` such that `r^k <= n`
+ */
+[[nodiscard]] inline natural natural_root(const natural &n, std::size_t k)
+{
+	const auto size = std::ranges::size(n.digits());
+
+	if (size <= 2)
+	{
+		return natural(small_root(static_cast<std::uintmax_t>(n), k));
+	}
+
+	// the number is below 2^(30 * size), so the root is 1
+	if (k >= 30 * size)
+	{
+		return 1;
+	}
+
+	natural root;
+	if (size < 4 * k)
+	{
+		root = root_estimate(n, k);
+	}
+	else
+	{
+		const auto shift = size / (2 * k);
+
+		root = natural_root(n >> (k * shift), k);
+		++root;
+		root <<= shift;
+	}
+
+	while (true)
+	{
+		natural next(root);
+
+		if (k == 2)
+		{
+			next += n / root;
+			next.div_digit(2);
+		}
+		else
+		{
+			next *= k - 1;
+			next += n / pow(root, k - 1);
+			next /= k;
+		}
+
+		if (next >= root)
+		{
+			return root;
+		}
+
+		root = std::move(next);
+	}
+}
+}
+
+/**
+ * Calculates the integer k-th root of a number.
+ *
+ * @tparam T Value type
+ *
+ * @param n Integer-like
+ * @param k Root degree
+ *
+ * @return `n` to the power of `1/k`, truncated towards zero
+ *
+ * @throws `std::domain_error` if `k` is zero, or if `k` is even and `n` is negative
+ */
+template <traits::unbounded_integer_like T>
+[[nodiscard]] T iroot(const T &n, std::size_t k)
+{
+	if (k == 0)
+	{
+		throw std::domain_error("root of degree zero is undefined");
+	}
+
+	if constexpr (traits::natural_like<T>)
+	{
+		return detail::natural_root(n, k);
+	}
+	else
+	{
+		const bool negative = numeric::sign_bit(n);
+		if (negative && k % 2 == 0)
+		{
+			throw std::domain_error("root of even degree of a negative number is undefined");
+		}
+
+		return T(detail::natural_root(numeric::abs(n), k), negative);
+	}
+}
+
+/**
+ * Calculates the integer square root of a number.
+ *
+ * @tparam T Value type
+ *
+ * @param n Integer-like
+ *
+ * @return Largest `s` such that `s * s <= n`
+ *
+ * @throws `std::domain_error` if `n` is negative
+ */
+template <traits::unbounded_integer_like T>
+[[nodiscard]] T isqrt(const T &n)
+{
+	return iroot(n, 2);
+}
+
+/**
+ * Calculates the integer square root of a number along with the remainder.
+ *
+ * @tparam T Value type
+ *
+ * @param n Integer-like
+ *
+ * @return `{s, n - s * s}` pair, where `s` is the integer square root of `n`
+ *
+ * @throws `std::domain_error` if `n` is negative
+ */
+template <traits::unbounded_integer_like T>
+[[nodiscard]] std::pair<T, T> sqrtrem(const T &n)
+{
+	T root = isqrt(n);
+	T remainder = n - root * root;
+
+	return {std::move(root), std::move(remainder)};
+}
+}
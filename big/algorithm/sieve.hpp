@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+
+namespace big::algorithm
+{
+/**
+ * Finds all primes not exceeding the limit using the sieve of Eratosthenes.
+ *
+ * @param limit Upper bound
+ *
+ * @return Primes in ascending order
+ */
+[[nodiscard]] constexpr std::vector<std::size_t> primes_up_to(std::size_t limit)
+{
+	std::vector<std::size_t> primes;
+
+	if (limit < 2)
+	{
+		return primes;
+	}
+
+	// only odd numbers are sieved, `i` stands for `2 * i + 1`
+	std::vector<bool> composite(limit / 2 + 1);
+	primes.push_back(2);
+
+	for (std::size_t i = 1; 2 * i + 1 <= limit; ++i)
+	{
+		if (composite[i])
+		{
+			continue;
+		}
+
+		const auto prime = 2 * i + 1;
+		primes.push_back(prime);
+
+		for (auto multiple = prime * prime; multiple <= limit; multiple += 2 * prime)
+		{
+			composite[multiple / 2] = true;
+		}
+	}
+
+	return primes;
+}
+
+/**
+ * Checks a machine word for being prime by trial division.
+ *
+ * @param value Value
+ *
+ * @return `true` if `value` is prime, `false` otherwise
+ */
+[[nodiscard]] constexpr bool is_small_prime(std::uintmax_t value) noexcept
+{
+	if (value < 4)
+	{
+		return value > 1;
+	}
+
+	if (value % 2 == 0 || value % 3 == 0)
+	{
+		return false;
+	}
+
+	for (std::uintmax_t divisor = 5; divisor <= value / divisor; divisor += 6)
+	{
+		if (value % divisor == 0 || value % (divisor + 2) == 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+}
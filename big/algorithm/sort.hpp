@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <vector>
+#include "../natural/natural_view.hpp"
+
+
+namespace big::algorithm
+{
+namespace detail
+{
+/**
+ * Sorting key of a number, ordered as the number itself unless the keys are equal.
+ */
+struct sort_key
+{
+	// limb count in the upper half and the most significant limb in the lower one
+	std::uint64_t key;
+	natural_view value;
+	std::size_t index;
+};
+
+[[nodiscard]] constexpr std::uint64_t make_sort_key(natural_view value) noexcept
+{
+	const auto size = value.size();
+
+	// keys of numbers with too many limbs are all equal, so that they are compared in full
+	if (size > std::numeric_limits<std::uint32_t>::max() - std::uint64_t{1})
+	{
+		return std::numeric_limits<std::uint64_t>::max();
+	}
+
+	return std::uint64_t{size} << 32 | value[size - 1];
+}
+
+[[nodiscard]] constexpr bool key_less(const sort_key &lhs, const sort_key &rhs) noexcept
+{
+	if (lhs.key != rhs.key)
+	{
+		return lhs.key < rhs.key;
+	}
+
+	return lhs.value < rhs.value;
+}
+}
+
+/**
+ * Finds the order in which a range of numbers is sorted.
+ *
+ * The numbers are ordered by their limb counts and most significant limbs
+ * first, which are packed into a single integer, and only the numbers with
+ * equal keys are compared limb by limb.
+ *
+ * @tparam R Range type
+ *
+ * @param values Numbers
+ *
+ * @return Indices of the numbers in ascending order of the numbers
+ */
+template <std::ranges::random_access_range R>
+	requires std::ranges::sized_range<R> && std::convertible_to<std::ranges::range_reference_t<R>, natural_view>
+[[nodiscard]] std::vector<std::size_t> sort_permutation(R &&values)
+{
+	const auto size = std::ranges::size(values);
+
+	std::vector<detail::sort_key> keys;
+	keys.reserve(size);
+
+	auto it = std::ranges::begin(values);
+	for (std::size_t i = 0; i < size; ++i, ++it)
+	{
+		const natural_view value = *it;
+		keys.push_back({detail::make_sort_key(value), value, i});
+	}
+
+	std::ranges::sort(keys, detail::key_less);
+
+	std::vector<std::size_t> order(size);
+	std::ranges::transform(keys, std::ranges::begin(order), &detail::sort_key::index);
+	return order;
+}
+
+/**
+ * Sorts a range of numbers in ascending order.
+ *
+ * The order is found by `sort_permutation` on the keys of the numbers, which
+ * are then moved to their places along the cycles of the permutation, so
+ * every number is moved at most twice.
+ *
+ * @tparam R Range type
+ *
+ * @param values Numbers
+ *
+ * @return Iterator to the end of `values`
+ */
+template <std::ranges::random_access_range R>
+	requires std::ranges::sized_range<R> && std::permutable<std::ranges::iterator_t<R>>
+		&& std::convertible_to<std::ranges::range_reference_t<R>, natural_view>
+std::ranges::borrowed_iterator_t<R> sort(R &&values)
+{
+	const auto first = std::ranges::begin(values);
+	const auto order = sort_permutation(values);
+
+	std::vector<bool> placed(std::ranges::size(order));
+	for (std::size_t i = 0; i < std::ranges::size(order); ++i)
+	{
+		if (placed[i] || order[i] == i)
+		{
+			continue;
+		}
+
+		std::ranges::range_value_t<R> tmp = std::ranges::iter_move(first + i);
+
+		auto j = i;
+		for (; order[j] != i; j = order[j])
+		{
+			first[j] = std::ranges::iter_move(first + order[j]);
+			placed[j] = true;
+		}
+
+		first[j] = std::move(tmp);
+		placed[j] = true;
+	}
+
+	return first + std::ranges::ssize(order);
+}
+
+/**
+ * Removes consecutive duplicates from a range of numbers.
+ *
+ * The limb counts and the most significant limbs of neighbouring numbers are
+ * compared before the rest of their limbs.
+ *
+ * @tparam R Range type
+ *
+ * @param values Numbers
+ *
+ * @return Subrange of the leftover elements past the unique numbers, as for `std::ranges::unique`
+ */
+template <std::ranges::forward_range R>
+	requires std::permutable<std::ranges::iterator_t<R>>
+		&& std::convertible_to<std::ranges::range_reference_t<R>, natural_view>
+std::ranges::borrowed_subrange_t<R> unique(R &&values)
+{
+	const auto equal = [](natural_view lhs, natural_view rhs)
+	{
+		return detail::make_sort_key(lhs) == detail::make_sort_key(rhs) && lhs == rhs;
+	};
+
+	return std::ranges::unique(values, equal, [](const auto &value) { return natural_view(value); });
+}
+}
@@ -0,0 +1,626 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../natural/natural.hpp"
+#include "../integer/integer.hpp"
+#include "../rational/rational.hpp"
+#include "../algorithm/power_cache.hpp"
+
+
+namespace big::conv
+{
+/**
+ * Version of the binary format written by `serialize`.
+ *
+ * Every value starts with the version and the kind of the value, one byte each.
+ * A natural number is the LEB128 count of its limbs followed by the limbs, four
+ * little-endian bytes each, starting from the least significant one. An integer
+ * is a sign byte followed by its absolute value, and a rational number is its
+ * numerator followed by its denominator, both without the leading bytes.
+ */
+inline constexpr std::uint8_t binary_format_version = 1;
+
+/**
+ * Order of the words in `import_bytes` and `export_bytes`.
+ */
+enum class word_order
+{
+	least_significant_first,
+	most_significant_first
+};
+
+namespace detail
+{
+enum class value_kind : std::uint8_t
+{
+	natural = 1,
+	integer = 2,
+	rational = 3
+};
+
+template <typename T>
+inline constexpr bool is_serializable = std::same_as<T, natural> || std::same_as<T, integer> || std::same_as<T, rational>;
+
+template <typename T>
+[[nodiscard]] constexpr value_kind kind_of() noexcept
+{
+	if constexpr (std::same_as<T, natural>)
+	{
+		return value_kind::natural;
+	}
+	else if constexpr (std::same_as<T, integer>)
+	{
+		return value_kind::integer;
+	}
+	else
+	{
+		return value_kind::rational;
+	}
+}
+
+using limb_bytes = std::array<std::byte, sizeof(natural::digit_type)>;
+
+// limbs are copied as a whole on little-endian hosts
+inline constexpr bool native_limbs = std::endian::native == std::endian::little;
+
+// number of limbs read at once, so that a corrupted count does not allocate the whole memory up front
+inline constexpr std::size_t limb_chunk = std::size_t{1} << 16;
+
+[[nodiscard]] constexpr std::size_t varint_size(std::uint64_t value) noexcept
+{
+	std::size_t size = 1;
+	for (; value >= 0x80; value >>= 7)
+	{
+		++size;
+	}
+
+	return size;
+}
+
+[[nodiscard]] constexpr std::size_t body_size(const natural &value) noexcept
+{
+	const auto count = std::ranges::size(value.digits());
+	return varint_size(count) + count * sizeof(natural::digit_type);
+}
+
+[[nodiscard]] constexpr std::size_t body_size(const integer &value) noexcept
+{
+	return 1 + body_size(value.abs());
+}
+
+[[nodiscard]] constexpr std::size_t body_size(const rational &value) noexcept
+{
+	return body_size(value.numerator()) + body_size(value.denominator());
+}
+
+/**
+ * Writes the body of a value.
+ *
+ * @tparam Put Function type
+ *
+ * @param value Value
+ * @param put   Function called with `(pointer, size)` of every run of bytes to write
+ */
+template <typename Put>
+void encode(const natural &value, Put &put)
+{
+	const auto &digits = value.digits();
+
+	std::array<std::byte, 10> count{};
+	std::size_t length = 0;
+	for (std::uint64_t rest = std::ranges::size(digits);; rest >>= 7)
+	{
+		count[length++] = static_cast<std::byte>((rest & 0x7F) | (rest >= 0x80 ? 0x80 : 0));
+		if (rest < 0x80)
+		{
+			break;
+		}
+	}
+
+	put(count.data(), length);
+
+	if constexpr (native_limbs)
+	{
+		put(reinterpret_cast<const std::byte *>(std::ranges::data(digits)), std::ranges::size(digits) * sizeof(natural::digit_type));
+	}
+	else
+	{
+		for (const auto digit : digits)
+		{
+			limb_bytes bytes{};
+			for (std::size_t i = 0; i < bytes.size(); ++i)
+			{
+				bytes[i] = static_cast<std::byte>(digit >> (8 * i));
+			}
+
+			put(bytes.data(), bytes.size());
+		}
+	}
+}
+
+template <typename Put>
+void encode(const integer &value, Put &put)
+{
+	const auto sign = static_cast<std::byte>(value.sign_bit());
+	put(&sign, 1);
+	encode(value.abs(), put);
+}
+
+template <typename Put>
+void encode(const rational &value, Put &put)
+{
+	encode(value.numerator(), put);
+	encode(value.denominator(), put);
+}
+
+template <typename T, typename Put>
+void encode_value(const T &value, Put &put)
+{
+	const std::array header{static_cast<std::byte>(binary_format_version), static_cast<std::byte>(kind_of<T>())};
+	put(header.data(), header.size());
+	encode(value, put);
+}
+
+/**
+ * Reads a single byte.
+ *
+ * @tparam Get Function type
+ *
+ * @param get Function called with `(pointer, size)` of every run of bytes to read,
+ *            throws `std::invalid_argument` if there are not enough bytes
+ */
+template <typename Get>
+[[nodiscard]] std::uint8_t decode_byte(Get &get)
+{
+	std::byte byte{};
+	get(&byte, 1);
+	return std::to_integer<std::uint8_t>(byte);
+}
+
+template <typename Get>
+[[nodiscard]] natural decode_natural(Get &get)
+{
+	std::uint64_t count = 0;
+	for (unsigned shift = 0;; shift += 7)
+	{
+		const auto byte = decode_byte(get);
+		if (shift == 63 && byte > 1)
+		{
+			throw std::invalid_argument("an invalid binary number, the limb count is too large");
+		}
+
+		count |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+		{
+			break;
+		}
+	}
+
+	if (count == 0)
+	{
+		throw std::invalid_argument("an invalid binary number, a natural number has no limbs");
+	}
+
+	natural::digits_type digits;
+	for (std::uint64_t read = 0; read < count;)
+	{
+		const auto chunk = std::min<std::uint64_t>(count - read, limb_chunk);
+		digits.resize(read + chunk);
+		get(reinterpret_cast<std::byte *>(std::ranges::data(digits) + read), chunk * sizeof(natural::digit_type));
+		read += chunk;
+	}
+
+	if constexpr (!native_limbs)
+	{
+		for (auto &digit : digits)
+		{
+			limb_bytes bytes{};
+			std::memcpy(bytes.data(), &digit, bytes.size());
+
+			digit = 0;
+			for (std::size_t i = 0; i < bytes.size(); ++i)
+			{
+				digit |= std::to_integer<natural::digit_type>(bytes[i]) << (8 * i);
+			}
+		}
+	}
+
+	return natural(std::move(digits));
+}
+
+template <typename Get>
+[[nodiscard]] integer decode_integer(Get &get)
+{
+	const auto sign = decode_byte(get);
+	if (sign > 1)
+	{
+		throw std::invalid_argument("an invalid binary number, the sign byte is " + std::to_string(sign));
+	}
+
+	auto abs = decode_natural(get);
+	const bool negative = sign && !abs.is_zero();
+	return integer(std::move(abs), negative);
+}
+
+template <typename Get>
+[[nodiscard]] rational decode_rational(Get &get)
+{
+	auto numerator = decode_integer(get);
+	auto denominator = decode_natural(get);
+
+	if (denominator.is_zero())
+	{
+		throw std::invalid_argument("an invalid binary number, the denominator is zero");
+	}
+
+	return rational(numerator, denominator);
+}
+
+template <typename T, typename Get>
+[[nodiscard]] T decode_value(Get &get)
+{
+	const auto version = decode_byte(get);
+	if (version != binary_format_version)
+	{
+		throw std::invalid_argument("an unsupported binary format version " + std::to_string(version));
+	}
+
+	if (decode_byte(get) != static_cast<std::uint8_t>(kind_of<T>()))
+	{
+		throw std::invalid_argument("an invalid binary number, the stored kind of value does not match");
+	}
+
+	if constexpr (std::same_as<T, natural>)
+	{
+		return decode_natural(get);
+	}
+	else if constexpr (std::same_as<T, integer>)
+	{
+		return decode_integer(get);
+	}
+	else
+	{
+		return decode_rational(get);
+	}
+}
+
+// numbers of at most this many bytes are imported by Horner's method
+inline constexpr std::size_t import_threshold = 64;
+
+/**
+ * Converts little-endian bytes into a number.
+ *
+ * The bytes are split at the largest power of two below their count, and the
+ * high part is scaled by a power of 256 taken from the process-wide power cache.
+ *
+ * @param bytes Bytes, starting from the least significant one
+ *
+ * @return Number
+ */
+[[nodiscard]] inline natural import_le(std::span<const std::uint8_t> bytes)
+{
+	const auto size = std::ranges::size(bytes);
+
+	if (size <= import_threshold)
+	{
+		natural result{};
+
+		// three bytes at a time, so that the multiplier remains a single digit
+		auto position = size;
+		while (position > 0)
+		{
+			const auto step = position % 3 == 0 ? 3 : position % 3;
+			position -= step;
+
+			natural::digit_type chunk = 0;
+			for (std::size_t i = step; i-- > 0;)
+			{
+				chunk = chunk << 8 | bytes[position + i];
+			}
+
+			result.mul_digit(natural::digit_type{1} << (8 * step));
+			result += chunk;
+		}
+
+		return result;
+	}
+
+	const auto split = std::bit_floor(size - 1);
+
+	auto result = import_le(bytes.subspan(split));
+	result *= *algorithm::power_cache::global().square(2, 3 + std::countr_zero(split));
+	result += import_le(bytes.first(split));
+
+	return result;
+}
+
+/**
+ * Gets the position of a byte of a word in the input or output of `import_bytes` and `export_bytes`.
+ *
+ * @param index     Index of the byte, starting from the least significant one
+ * @param count     Number of words
+ * @param word_size Size of a word in bytes
+ * @param order     Order of the words
+ * @param endian    Order of the bytes in a word
+ *
+ * @return Position of the byte
+ */
+[[nodiscard]] constexpr std::size_t byte_position(std::size_t index, std::size_t count, std::size_t word_size,
+	word_order order, std::endian endian) noexcept
+{
+	const auto word = index / word_size;
+	const auto byte = index % word_size;
+
+	const auto word_position = order == word_order::least_significant_first ? word : count - 1 - word;
+	const auto byte_position = endian == std::endian::little ? byte : word_size - 1 - byte;
+
+	return word_position * word_size + byte_position;
+}
+
+inline void check_word_size(std::size_t word_size)
+{
+	if (word_size == 0)
+	{
+		throw std::invalid_argument("the word size must be positive");
+	}
+}
+}
+
+/**
+ * Computes the size of the binary representation of a value.
+ *
+ * @param value Value
+ *
+ * @return Number of bytes written by `serialize`
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+[[nodiscard]] constexpr std::size_t serialized_size(const T &value) noexcept
+{
+	return 2 + detail::body_size(value);
+}
+
+/**
+ * Writes the binary representation of a value into a buffer.
+ *
+ * @param value  Value
+ * @param output Buffer
+ *
+ * @return Number of bytes written
+ *
+ * @throws `std::length_error` if the buffer is smaller than `serialized_size(value)`
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+std::size_t serialize(const T &value, std::span<std::byte> output)
+{
+	const auto size = serialized_size(value);
+	if (std::ranges::size(output) < size)
+	{
+		throw std::length_error("the buffer of " + std::to_string(std::ranges::size(output))
+			+ " bytes is too small for " + std::to_string(size) + " bytes");
+	}
+
+	auto *position = std::ranges::data(output);
+	const auto put = [&position](const std::byte *data, std::size_t count)
+	{
+		std::memcpy(position, data, count);
+		position += count;
+	};
+
+	detail::encode_value(value, put);
+	return size;
+}
+
+/**
+ * Writes the binary representation of a value into a new buffer.
+ *
+ * @param value Value
+ *
+ * @return Buffer of `serialized_size(value)` bytes
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+[[nodiscard]] std::vector<std::byte> serialize(const T &value)
+{
+	std::vector<std::byte> output(serialized_size(value));
+	serialize(value, std::span(output));
+	return output;
+}
+
+/**
+ * Writes the binary representation of a value into a stream.
+ *
+ * @param value Value
+ * @param out   Output stream, opened in binary mode
+ *
+ * @return Reference to `out`
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+std::ostream &serialize(const T &value, std::ostream &out)
+{
+	const auto put = [&out](const std::byte *data, std::size_t count)
+	{
+		out.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(count));
+	};
+
+	detail::encode_value(value, put);
+	return out;
+}
+
+/**
+ * Reads a value from the beginning of a buffer.
+ *
+ * @param input    Buffer
+ * @param consumed Set to the number of bytes read
+ *
+ * @return Value
+ *
+ * @throws `std::invalid_argument` if the buffer does not start with a valid representation of a `T`
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+[[nodiscard]] T deserialize(std::span<const std::byte> input, std::size_t &consumed)
+{
+	std::size_t position = 0;
+	const auto get = [&input, &position](std::byte *data, std::size_t count)
+	{
+		if (std::ranges::size(input) - position < count)
+		{
+			throw std::invalid_argument("an invalid binary number, the input is truncated");
+		}
+
+		std::memcpy(data, std::ranges::data(input) + position, count);
+		position += count;
+	};
+
+	auto result = detail::decode_value<T>(get);
+	consumed = position;
+	return result;
+}
+
+/**
+ * Reads a value that occupies a whole buffer.
+ *
+ * @param input Buffer
+ *
+ * @return Value
+ *
+ * @throws `std::invalid_argument` if the buffer is not a valid representation of a `T`
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+[[nodiscard]] T deserialize(std::span<const std::byte> input)
+{
+	std::size_t consumed = 0;
+	auto result = deserialize<T>(input, consumed);
+
+	if (consumed != std::ranges::size(input))
+	{
+		throw std::invalid_argument("an invalid binary number, " + std::to_string(std::ranges::size(input) - consumed)
+			+ " bytes follow the value");
+	}
+
+	return result;
+}
+
+/**
+ * Reads a value from a stream.
+ *
+ * @param in Input stream, opened in binary mode
+ *
+ * @return Value
+ *
+ * @throws `std::invalid_argument` if the stream does not continue with a valid representation of a `T`
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+[[nodiscard]] T deserialize(std::istream &in)
+{
+	const auto get = [&in](std::byte *data, std::size_t count)
+	{
+		if (!in.read(reinterpret_cast<char *>(data), static_cast<std::streamsize>(count)))
+		{
+			throw std::invalid_argument("an invalid binary number, the stream is truncated");
+		}
+	};
+
+	return detail::decode_value<T>(get);
+}
+
+/**
+ * Converts the binary representation of a number into the number, like `mpz_import`.
+ *
+ * @param bytes     Words of the representation, `word_size` bytes each
+ * @param word_size Size of a word in bytes
+ * @param order     Order of the words
+ * @param endian    Order of the bytes in a word
+ *
+ * @return Number
+ *
+ * @throws `std::invalid_argument` if `word_size` is zero or does not divide the number of bytes
+ */
+[[nodiscard]] inline natural import_bytes(std::span<const std::byte> bytes, std::size_t word_size = 1,
+	word_order order = word_order::most_significant_first, std::endian endian = std::endian::big)
+{
+	detail::check_word_size(word_size);
+
+	const auto size = std::ranges::size(bytes);
+	if (size % word_size != 0)
+	{
+		throw std::invalid_argument(std::to_string(size) + " bytes do not form words of " + std::to_string(word_size) + " bytes");
+	}
+
+	std::vector<std::uint8_t> le(size);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		le[i] = std::to_integer<std::uint8_t>(bytes[detail::byte_position(i, size / word_size, word_size, order, endian)]);
+	}
+
+	while (!le.empty() && le.back() == 0)
+	{
+		le.pop_back();
+	}
+
+	return detail::import_le(le);
+}
+
+/**
+ * Converts a number into its binary representation, like `mpz_export`.
+ *
+ * @param value     Number
+ * @param word_size Size of a word in bytes
+ * @param order     Order of the words
+ * @param endian    Order of the bytes in a word
+ *
+ * @return Words of the representation, as few as possible; no words for zero
+ *
+ * @throws `std::invalid_argument` if `word_size` is zero
+ */
+[[nodiscard]] inline std::vector<std::byte> export_bytes(const natural &value, std::size_t word_size = 1,
+	word_order order = word_order::most_significant_first, std::endian endian = std::endian::big)
+{
+	detail::check_word_size(word_size);
+
+	// three bytes at a time, so that the divisor remains a single digit
+	std::vector<std::uint8_t> le;
+	le.reserve(std::ranges::size(value.digits()) * 4);
+
+	natural rest = value;
+	while (!rest.is_zero())
+	{
+		const auto chunk = rest.div_digit(natural::digit_type{1} << 24);
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			le.push_back(static_cast<std::uint8_t>(chunk >> (8 * i)));
+		}
+	}
+
+	while (!le.empty() && le.back() == 0)
+	{
+		le.pop_back();
+	}
+
+	const auto count = (std::ranges::size(le) + word_size - 1) / word_size;
+	le.resize(count * word_size);
+
+	std::vector<std::byte> output(count * word_size);
+	for (std::size_t i = 0; i < std::ranges::size(le); ++i)
+	{
+		output[detail::byte_position(i, count, word_size, order, endian)] = static_cast<std::byte>(le[i]);
+	}
+
+	return output;
+}
+}
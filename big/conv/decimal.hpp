@@ -0,0 +1,214 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../execution/execution.hpp"
+#include "../natural/natural_view.hpp"
+
+
+namespace big::conv
+{
+namespace detail
+{
+using digit_type = natural_view::digit_type;
+
+inline constexpr std::size_t digits_per_limb = 9;
+
+// number of characters formatted at once by `write_decimal`
+inline constexpr std::size_t decimal_block = std::size_t{1} << 20;
+
+inline constexpr auto digit_pairs = []
+{
+	std::array<char, 200> pairs{};
+	for (std::size_t i = 0; i < 100; ++i)
+	{
+		pairs[2 * i] = static_cast<char>('0' + i / 10);
+		pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+	}
+
+	return pairs;
+}();
+
+/**
+ * Formats a limb as exactly nine digits, padded with zeroes.
+ *
+ * @param limb Limb value
+ * @param out  Buffer of at least nine characters
+ */
+constexpr void format_limb(digit_type limb, char *out) noexcept
+{
+	out[8] = static_cast<char>('0' + limb % 10);
+	limb /= 10;
+
+	for (std::size_t i = 4; i-- > 0;)
+	{
+		const auto pair = 2 * (limb % 100);
+		out[2 * i] = digit_pairs[pair];
+		out[2 * i + 1] = digit_pairs[pair + 1];
+		limb /= 100;
+	}
+}
+
+[[nodiscard]] constexpr std::size_t limb_width(digit_type limb) noexcept
+{
+	std::size_t width = 1;
+	for (; limb >= 10; limb /= 10)
+	{
+		++width;
+	}
+
+	return width;
+}
+}
+
+/**
+ * Computes the number of decimal digits of a number.
+ *
+ * @param value Number
+ *
+ * @return Number of digits, one for zero
+ */
+[[nodiscard]] constexpr std::size_t decimal_size(natural_view value) noexcept
+{
+	return detail::limb_width(value[value.size() - 1]) + detail::digits_per_limb * (value.size() - 1);
+}
+
+/**
+ * Formats a range of the decimal digits of a number.
+ *
+ * Every limb holds nine decimal digits, so any range of the digits can be
+ * formatted without formatting the digits before it.
+ *
+ * @param value Number
+ * @param first Position of the first digit to format, counting from the most significant one
+ * @param count Number of digits to format
+ * @param out   Buffer of at least `count` characters
+ *
+ * @return Pointer past the last written character
+ *
+ * @note This function expects `first + count` not to exceed `decimal_size(value)`.
+ */
+constexpr char *format_decimal(natural_view value, std::size_t first, std::size_t count, char *out) noexcept
+{
+	const auto top = value.size() - 1;
+	const auto top_width = detail::limb_width(value[top]);
+
+	std::array<char, detail::digits_per_limb> limb{};
+	const auto end = first + count;
+
+	while (first < end)
+	{
+		// the most significant limb is not padded
+		std::size_t index = top;
+		std::size_t offset = first;
+		std::size_t width = top_width;
+
+		if (first >= top_width)
+		{
+			index = top - 1 - (first - top_width) / detail::digits_per_limb;
+			offset = (first - top_width) % detail::digits_per_limb;
+			width = detail::digits_per_limb;
+		}
+
+		detail::format_limb(value[index], limb.data());
+
+		const auto skip = detail::digits_per_limb - width + offset;
+		const auto size = std::min(width - offset, end - first);
+		out = std::copy_n(limb.data() + skip, size, out);
+		first += size;
+	}
+
+	return out;
+}
+
+/**
+ * Writes the decimal digits of a number to an output iterator.
+ *
+ * @tparam It Output iterator type
+ *
+ * @param value Number
+ * @param out   Output iterator
+ *
+ * @return Iterator past the last written character
+ *
+ * @note The digits are formatted in blocks of bounded size, the whole string is never materialized.
+ */
+template <std::output_iterator<char> It>
+It write_decimal(natural_view value, It out)
+{
+	const auto size = decimal_size(value);
+	std::vector<char> block(std::min(size, detail::decimal_block));
+
+	for (std::size_t first = 0; first < size; first += std::ranges::size(block))
+	{
+		const auto count = std::min(std::ranges::size(block), size - first);
+		format_decimal(value, first, count, std::ranges::data(block));
+		out = std::ranges::copy_n(std::ranges::data(block), static_cast<std::ptrdiff_t>(count), std::move(out)).out;
+	}
+
+	return out;
+}
+
+/**
+ * Writes the decimal digits of a number to a file descriptor.
+ *
+ * Every round formats one block of digits per thread of the policy and writes
+ * the blocks in order, so the auxiliary memory is bounded by the number of
+ * threads and the descriptor does not have to be seekable.
+ *
+ * @param value  Number
+ * @param fd     File descriptor open for writing
+ * @param policy Execution policy to format the blocks of a round under
+ *
+ * @throws `std::system_error` if writing fails
+ */
+inline void write_decimal(natural_view value, int fd, const execution::policy &policy = execution::default_policy())
+{
+	const auto size = decimal_size(value);
+	const auto block = std::min(size, detail::decimal_block);
+	const auto blocks = std::min((size + block - 1) / block, policy.concurrency());
+
+	std::vector<char> buffer(block * blocks);
+
+	for (std::size_t first = 0; first < size;)
+	{
+		const auto round = std::min(std::ranges::size(buffer), size - first);
+
+		execution::parallel_for(policy, (round + block - 1) / block, 1, [&](std::size_t begin, std::size_t end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				const auto count = std::min(block, round - i * block);
+				format_decimal(value, first + i * block, count, std::ranges::data(buffer) + i * block);
+			}
+		});
+
+		for (std::size_t written = 0; written < round;)
+		{
+			const auto result = ::write(fd, std::ranges::data(buffer) + written, round - written);
+			if (result < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				throw std::system_error(errno, std::generic_category(), "cannot write the digits");
+			}
+
+			written += static_cast<std::size_t>(result);
+		}
+
+		first += round;
+	}
+}
+}
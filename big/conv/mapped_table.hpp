@@ -0,0 +1,394 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "binary.hpp"
+#include "../memory/mapped_file.hpp"
+
+
+namespace big::conv
+{
+/**
+ * Version of the table layout written by `write_table`.
+ *
+ * A table starts with a 64-byte header, followed by the limb offsets of every
+ * stored natural number, the sign bytes of integer and rational tables, and
+ * the limbs of all numbers stored back to back, 64-byte aligned. Integers are
+ * stored as their absolute values, rational numbers as the absolute values of
+ * their numerators followed by their denominators. All fields are little-endian.
+ */
+inline constexpr std::uint32_t table_format_version = 1;
+
+namespace detail
+{
+inline constexpr std::array<char, 8> table_magic{'B', 'I', 'G', 'T', 'A', 'B', 'L', 'E'};
+inline constexpr std::uint64_t table_alignment = 64;
+
+struct table_header
+{
+	std::array<char, 8> magic;
+	std::uint32_t version;
+	std::uint32_t kind;
+	std::uint64_t count;
+	std::uint64_t numbers;
+	std::uint64_t offsets_offset;
+	std::uint64_t signs_offset;
+	std::uint64_t limbs_offset;
+	std::uint64_t limb_count;
+};
+
+static_assert(sizeof(table_header) == table_alignment);
+
+template <typename T>
+[[nodiscard]] constexpr std::size_t parts_of() noexcept
+{
+	return std::same_as<T, rational> ? 2 : 1;
+}
+
+[[nodiscard]] constexpr std::uint64_t align_up(std::uint64_t value, std::uint64_t alignment) noexcept
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+}
+
+/**
+ * Table of numbers accessed directly over a memory-mapped file.
+ *
+ * Opening a table only checks its header and index, the limbs are paged in
+ * by the operating system when they are first viewed. Views returned by the
+ * table point into the mapping and remain valid while the table is alive.
+ *
+ * @tparam T Type of the stored numbers, `natural`, `integer` or `rational`
+ *
+ * @note The limbs are trusted to be valid digits, call `verify` to check
+ *       a table that may have been written by something else than `write_table`.
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+class mapped_table
+{
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+
+	// number of stored naturals per value
+	static constexpr size_type parts = detail::parts_of<T>();
+private:
+	memory::mapped_file file_;
+	size_type size_ = 0;
+	std::span<const std::uint64_t> offsets_;
+	std::span<const std::uint8_t> signs_;
+	std::span<const natural::digit_type> limbs_;
+
+	[[noreturn]] static void invalid(const std::string &reason)
+	{
+		throw std::invalid_argument("an invalid number table, " + reason);
+	}
+
+	template <typename U>
+	[[nodiscard]] std::span<const U> section(std::uint64_t offset, std::uint64_t count) const
+	{
+		const auto bytes = file_.bytes();
+		if (offset % alignof(U) != 0 || offset > std::ranges::size(bytes)
+			|| count > (std::ranges::size(bytes) - offset) / sizeof(U))
+		{
+			invalid("a section is out of the file bounds");
+		}
+
+		return {reinterpret_cast<const U *>(std::ranges::data(bytes) + offset), static_cast<size_type>(count)};
+	}
+public:
+	/**
+	 * Opens a table.
+	 *
+	 * @param path Path of a file written by `write_table`
+	 *
+	 * @throws `std::system_error` if the file cannot be mapped
+	 * @throws `std::invalid_argument` if the header or the index of the table is invalid
+	 */
+	[[nodiscard]] explicit mapped_table(const std::filesystem::path &path) : file_(path)
+	{
+		if constexpr (std::endian::native != std::endian::little)
+		{
+			throw std::runtime_error("number tables can only be mapped on little-endian hosts");
+		}
+
+		const auto bytes = file_.bytes();
+		if (std::ranges::size(bytes) < sizeof(detail::table_header))
+		{
+			invalid("the file is too small");
+		}
+
+		detail::table_header header{};
+		std::memcpy(&header, std::ranges::data(bytes), sizeof(header));
+
+		if (header.magic != detail::table_magic)
+		{
+			invalid("the signature does not match");
+		}
+
+		if (header.version != table_format_version)
+		{
+			invalid("an unsupported version " + std::to_string(header.version));
+		}
+
+		if (header.kind != static_cast<std::uint32_t>(detail::kind_of<T>()))
+		{
+			invalid("the stored kind of values does not match");
+		}
+
+		if (header.count > header.numbers || header.numbers / parts != header.count || header.numbers % parts != 0)
+		{
+			invalid("the number of values does not match the number of naturals");
+		}
+
+		// one more offset than naturals is stored, which must not wrap around
+		if (header.numbers >= std::ranges::size(bytes) / sizeof(std::uint64_t))
+		{
+			invalid("a section is out of the file bounds");
+		}
+
+		size_ = static_cast<size_type>(header.count);
+		offsets_ = section<std::uint64_t>(header.offsets_offset, header.numbers + 1);
+		limbs_ = section<natural::digit_type>(header.limbs_offset, header.limb_count);
+
+		if constexpr (!std::same_as<T, natural>)
+		{
+			signs_ = section<std::uint8_t>(header.signs_offset, header.count);
+		}
+
+		if (offsets_.front() != 0 || offsets_.back() != header.limb_count)
+		{
+			invalid("the offsets do not cover the limbs");
+		}
+
+		for (size_type i = 1; i < std::ranges::size(offsets_); ++i)
+		{
+			if (offsets_[i] <= offsets_[i - 1])
+			{
+				invalid("the offsets are not increasing");
+			}
+		}
+	}
+
+	/**
+	 * Gets the number of values in the table.
+	 *
+	 * @return Number of values
+	 */
+	[[nodiscard]] size_type size() const noexcept
+	{
+		return size_;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	/**
+	 * Views a stored natural number without copying it.
+	 *
+	 * @param index Index of the value
+	 * @param part  Part of the value: the absolute value of an integer, the absolute value
+	 *              of the numerator of a rational number if zero, its denominator if one
+	 *
+	 * @return View over the mapping
+	 *
+	 * @throws `std::out_of_range` if `index` or `part` is out of range
+	 */
+	[[nodiscard]] natural_view view(size_type index, size_type part = 0) const
+	{
+		if (index >= size_ || part >= parts)
+		{
+			throw std::out_of_range("value " + std::to_string(index) + " is out of range");
+		}
+
+		const auto number = index * parts + part;
+		const auto begin = static_cast<size_type>(offsets_[number]);
+		const auto end = static_cast<size_type>(offsets_[number + 1]);
+
+		return natural_view::unchecked(limbs_.subspan(begin, end - begin));
+	}
+
+	/**
+	 * Gets the sign of a stored value.
+	 *
+	 * @param index Index of the value
+	 *
+	 * @return `true` if the value is negative, `false` otherwise
+	 *
+	 * @throws `std::out_of_range` if `index` is out of range
+	 */
+	[[nodiscard]] bool sign_bit(size_type index) const
+	{
+		if (index >= size_)
+		{
+			throw std::out_of_range("value " + std::to_string(index) + " is out of range");
+		}
+
+		return !std::ranges::empty(signs_) && signs_[index] != 0;
+	}
+
+	/**
+	 * Copies a stored value out of the mapping.
+	 *
+	 * @param index Index of the value
+	 *
+	 * @return Value
+	 *
+	 * @throws `std::out_of_range` if `index` is out of range
+	 */
+	[[nodiscard]] T operator[](size_type index) const
+	{
+		if constexpr (std::same_as<T, natural>)
+		{
+			return natural(view(index));
+		}
+		else if constexpr (std::same_as<T, integer>)
+		{
+			return integer(natural(view(index)), sign_bit(index));
+		}
+		else
+		{
+			// stored fractions are already in lowest terms
+			rational result;
+			result.numerator() = integer(natural(view(index, 0)), sign_bit(index));
+			result.denominator() = natural(view(index, 1));
+			return result;
+		}
+	}
+
+	/**
+	 * Checks every limb, sign and denominator of the table, paging in the whole file.
+	 *
+	 * @throws `std::invalid_argument` if a value of the table is invalid
+	 */
+	void verify() const
+	{
+		for (const auto limb : limbs_)
+		{
+			if (limb >= natural::number_system_base)
+			{
+				invalid("a limb cannot be represented in the number system");
+			}
+		}
+
+		for (size_type i = 0; i < size_; ++i)
+		{
+			if (!std::ranges::empty(signs_) && (signs_[i] > 1 || (signs_[i] == 1 && view(i).is_zero())))
+			{
+				invalid("value " + std::to_string(i) + " has an invalid sign");
+			}
+
+			if (parts == 2 && view(i, 1).is_zero())
+			{
+				invalid("value " + std::to_string(i) + " has a zero denominator");
+			}
+		}
+	}
+};
+
+/**
+ * Writes a table of numbers to be opened by `mapped_table`.
+ *
+ * @param path   Path of the file, overwritten if it exists
+ * @param values Values
+ *
+ * @throws `std::system_error` if the file cannot be written
+ */
+template <typename T>
+	requires detail::is_serializable<T>
+void write_table(const std::filesystem::path &path, std::span<const T> values)
+{
+	if constexpr (std::endian::native != std::endian::little)
+	{
+		throw std::runtime_error("number tables can only be written on little-endian hosts");
+	}
+
+	constexpr auto parts = detail::parts_of<T>();
+
+	std::vector<natural_view> numbers;
+	std::vector<std::uint8_t> signs;
+	numbers.reserve(std::ranges::size(values) * parts);
+
+	for (const auto &value : values)
+	{
+		if constexpr (std::same_as<T, natural>)
+		{
+			numbers.push_back(value);
+		}
+		else if constexpr (std::same_as<T, integer>)
+		{
+			numbers.push_back(value.abs());
+			signs.push_back(value.sign_bit());
+		}
+		else
+		{
+			numbers.push_back(value.numerator().abs());
+			numbers.push_back(value.denominator());
+			signs.push_back(value.sign_bit());
+		}
+	}
+
+	std::vector<std::uint64_t> offsets{0};
+	offsets.reserve(std::ranges::size(numbers) + 1);
+	for (const auto number : numbers)
+	{
+		offsets.push_back(offsets.back() + number.size());
+	}
+
+	detail::table_header header{};
+	header.magic = detail::table_magic;
+	header.version = table_format_version;
+	header.kind = static_cast<std::uint32_t>(detail::kind_of<T>());
+	header.count = std::ranges::size(values);
+	header.numbers = std::ranges::size(numbers);
+	header.offsets_offset = sizeof(header);
+	header.signs_offset = header.offsets_offset + std::ranges::size(offsets) * sizeof(std::uint64_t);
+	header.limbs_offset = detail::align_up(header.signs_offset + std::ranges::size(signs), detail::table_alignment);
+	header.limb_count = offsets.back();
+
+	if constexpr (std::same_as<T, natural>)
+	{
+		header.signs_offset = 0;
+	}
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	const auto write = [&out](const void *data, std::size_t size)
+	{
+		out.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+	};
+
+	write(&header, sizeof(header));
+	write(std::ranges::data(offsets), std::ranges::size(offsets) * sizeof(std::uint64_t));
+	write(std::ranges::data(signs), std::ranges::size(signs));
+
+	const std::array<char, detail::table_alignment> padding{};
+	const auto written = sizeof(header) + std::ranges::size(offsets) * sizeof(std::uint64_t) + std::ranges::size(signs);
+	write(padding.data(), header.limbs_offset - written);
+
+	for (const auto number : numbers)
+	{
+		write(std::ranges::data(number.digits()), number.size() * sizeof(natural::digit_type));
+	}
+
+	out.flush();
+	if (!out)
+	{
+		throw std::system_error(std::make_error_code(std::errc::io_error), "cannot write " + path.string());
+	}
+}
+}
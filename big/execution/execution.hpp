@@ -0,0 +1,264 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include "thread_pool.hpp"
+
+
+namespace big::execution
+{
+/**
+ * Execution policy of the library algorithms.
+ *
+ * A sequential policy runs everything on the calling thread, a parallel one
+ * forks the independent parts of the work onto a thread pool, either a given
+ * one or the global pool at the time of the call.
+ */
+class policy
+{
+	std::shared_ptr<thread_pool> pool_;
+	bool parallel_ = false;
+public:
+	/**
+	 * Constructs the sequential policy.
+	 */
+	[[nodiscard]] policy() noexcept = default;
+
+	/**
+	 * Constructs the sequential policy.
+	 *
+	 * @return Policy that runs everything on the calling thread
+	 */
+	[[nodiscard]] static policy sequenced() noexcept
+	{
+		return {};
+	}
+
+	/**
+	 * Constructs a parallel policy.
+	 *
+	 * @param pool Thread pool to run the work on, `nullptr` for the global pool
+	 *
+	 * @return Policy that runs the work on `pool`
+	 */
+	[[nodiscard]] static policy parallel(std::shared_ptr<thread_pool> pool = nullptr) noexcept
+	{
+		policy result;
+		result.pool_ = std::move(pool);
+		result.parallel_ = true;
+		return result;
+	}
+
+	/**
+	 * Constructs a parallel policy that runs on a dedicated pool.
+	 *
+	 * @param threads Total number of threads, including the calling one
+	 *
+	 * @return Policy that runs the work on at most `threads` threads
+	 */
+	[[nodiscard]] static policy with_threads(std::size_t threads)
+	{
+		if (threads <= 1)
+		{
+			return sequenced();
+		}
+
+		return parallel(std::make_shared<thread_pool>(threads - 1));
+	}
+
+	/**
+	 * Checks whether the policy allows parallel execution.
+	 *
+	 * @return `true` if the policy is parallel, `false` otherwise
+	 */
+	[[nodiscard]] bool is_parallel() const noexcept
+	{
+		return parallel_;
+	}
+
+	/**
+	 * Gets the thread pool to run the work on.
+	 *
+	 * @return Shared pointer to the pool, `nullptr` if the work has to be run sequentially
+	 */
+	[[nodiscard]] std::shared_ptr<thread_pool> pool() const
+	{
+		if (!parallel_)
+		{
+			return nullptr;
+		}
+
+		auto pool = pool_ ? pool_ : thread_pool::global();
+		if (pool->concurrency() == 1)
+		{
+			return nullptr;
+		}
+
+		return pool;
+	}
+
+	/**
+	 * Gets the number of threads the work may run on.
+	 *
+	 * @return Number of threads, one for sequential policies
+	 */
+	[[nodiscard]] std::size_t concurrency() const
+	{
+		const auto pool = this->pool();
+		return pool ? pool->concurrency() : 1;
+	}
+};
+
+/**
+ * Sequential policy.
+ */
+inline const policy seq = policy::sequenced();
+
+/**
+ * Parallel policy running on the global thread pool.
+ */
+inline const policy par = policy::parallel();
+
+namespace detail
+{
+/**
+ * Process-wide default policy.
+ */
+struct default_state
+{
+	std::mutex mutex;
+	policy value = par;
+};
+
+[[nodiscard]] inline default_state &global_default() noexcept
+{
+	static default_state state;
+	return state;
+}
+
+/**
+ * Default policy of the calling thread, overrides the global one while set.
+ */
+inline thread_local std::optional<policy> thread_default;
+}
+
+/**
+ * Gets the policy used by the entry points called without one.
+ *
+ * @return Policy of the innermost `scoped_policy` of the calling thread, the global default otherwise
+ */
+[[nodiscard]] inline policy default_policy()
+{
+	if (detail::thread_default)
+	{
+		return *detail::thread_default;
+	}
+
+	auto &state = detail::global_default();
+	std::scoped_lock lock(state.mutex);
+	return state.value;
+}
+
+/**
+ * Sets the policy used by the entry points called without one.
+ *
+ * @param value Policy, parallel on the global pool initially
+ */
+inline void set_default_policy(policy value)
+{
+	auto &state = detail::global_default();
+	std::scoped_lock lock(state.mutex);
+	state.value = std::move(value);
+}
+
+/**
+ * Overrides the default policy of the calling thread for the lifetime of the object.
+ */
+class scoped_policy
+{
+	// kept outside of an optional, moving out of one that may be empty trips -Wmaybe-uninitialized
+	policy previous_;
+	bool had_previous_ = false;
+public:
+	[[nodiscard]] explicit scoped_policy(policy value) : had_previous_(detail::thread_default.has_value())
+	{
+		if (had_previous_)
+		{
+			previous_ = std::move(*detail::thread_default);
+		}
+
+		detail::thread_default = std::move(value);
+	}
+
+	scoped_policy(const scoped_policy &) = delete;
+	scoped_policy &operator=(const scoped_policy &) = delete;
+
+	~scoped_policy()
+	{
+		if (had_previous_)
+		{
+			detail::thread_default = std::move(previous_);
+		}
+		else
+		{
+			detail::thread_default.reset();
+		}
+	}
+};
+
+/**
+ * Runs a function over consecutive chunks of a range of indices.
+ *
+ * @tparam F Function type
+ *
+ * @param policy Execution policy
+ * @param count  Number of indices
+ * @param grain  Minimum number of indices in a chunk
+ * @param f      Function called with the bounds `(begin, end)` of every chunk
+ *
+ * @throws The first exception thrown by `f`, if any
+ *
+ * @note Every chunk runs with `policy` as the default policy of its thread,
+ *       so nested operations obey the same policy. Chunks split between threads
+ *       allocate from the default resource, so the values they modify must be
+ *       created by `memory::make_unscoped`.
+ */
+template <typename F>
+void parallel_for(const policy &policy, std::size_t count, std::size_t grain, const F &f)
+{
+	const auto pool = policy.pool();
+	const auto chunks = pool ? std::clamp<std::size_t>(count / std::max<std::size_t>(grain, 1), 1, pool->concurrency()) : 1;
+
+	const auto run_chunk = [&policy, &f, count, chunks](std::size_t chunk)
+	{
+		scoped_policy scope(policy);
+		f(count * chunk / chunks, count * (chunk + 1) / chunks);
+	};
+
+	if (chunks <= 1)
+	{
+		if (count != 0)
+		{
+			run_chunk(0);
+		}
+
+		return;
+	}
+
+	task_group group(*pool);
+	for (std::size_t chunk = 1; chunk < chunks; ++chunk)
+	{
+		group.run([&run_chunk, chunk] { run_chunk(chunk); });
+	}
+
+	{
+		memory::scoped_resource scope(memory::default_resource());
+		run_chunk(0);
+	}
+
+	group.wait();
+}
+}
@@ -0,0 +1,388 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../memory/allocator.hpp"
+
+
+namespace big::execution
+{
+/**
+ * Unit of work submitted to a thread pool.
+ */
+class task
+{
+	friend class thread_pool;
+
+	std::function<void()> work_;
+	std::exception_ptr error_;
+	std::atomic<bool> done_{false};
+
+	/**
+	 * Runs the work, storing the exception it throws, if any.
+	 *
+	 * The work allocates from the default resource, as it may be run by a waiting thread
+	 * under a scoped resource that other threads must not allocate from.
+	 */
+	void run() noexcept
+	{
+		memory::scoped_resource scope(memory::default_resource());
+
+		try
+		{
+			work_();
+		}
+		catch (...)
+		{
+			error_ = std::current_exception();
+		}
+
+		done_.store(true, std::memory_order_release);
+	}
+public:
+	[[nodiscard]] explicit task(std::function<void()> work) : work_(std::move(work))
+	{
+	}
+
+	task(const task &) = delete;
+	task &operator=(const task &) = delete;
+
+	/**
+	 * Checks whether the work has been completed.
+	 *
+	 * @return `true` if the work is completed, `false` otherwise
+	 */
+	[[nodiscard]] bool done() const noexcept
+	{
+		return done_.load(std::memory_order_acquire);
+	}
+};
+
+/**
+ * Work-stealing thread pool for fork-join parallelism.
+ *
+ * Every worker owns a queue, takes its own tasks from the back and steals
+ * the tasks of the others from the front, so that the largest pending
+ * subproblems are the ones that migrate. Threads that wait for a task run
+ * other pending tasks meanwhile, so nested forks never block the pool.
+ */
+class thread_pool
+{
+public:
+	using size_type = std::size_t;
+private:
+	struct queue
+	{
+		std::mutex mutex;
+		std::deque<task *> tasks;
+	};
+
+	// the last queue receives the tasks submitted from outside of the pool
+	std::vector<std::unique_ptr<queue>> queues_;
+	std::atomic<size_type> pending_{0};
+	// bumped on every submission, idle workers sleep on it
+	std::atomic<std::uint64_t> epoch_{0};
+	std::vector<std::jthread> workers_;
+
+	inline static thread_local const thread_pool *current_pool_ = nullptr;
+	inline static thread_local size_type current_index_ = 0;
+
+	/**
+	 * Gets the index of the queue owned by the calling thread.
+	 */
+	[[nodiscard]] size_type own_queue() const noexcept
+	{
+		return current_pool_ == this ? current_index_ : std::ranges::size(queues_) - 1;
+	}
+
+	/**
+	 * Takes a pending task, preferring the latest one of the given queue.
+	 *
+	 * @param index Index of the queue to look into first
+	 *
+	 * @return Pointer to the task, `nullptr` if there are no pending tasks
+	 */
+	[[nodiscard]] task *take(size_type index)
+	{
+		if (pending_.load(std::memory_order_acquire) == 0)
+		{
+			return nullptr;
+		}
+
+		const auto count = std::ranges::size(queues_);
+
+		for (size_type i = 0; i < count; ++i)
+		{
+			auto &victim = *queues_[(index + i) % count];
+			std::scoped_lock lock(victim.mutex);
+
+			if (victim.tasks.empty())
+			{
+				continue;
+			}
+
+			task *result = nullptr;
+			if (i == 0)
+			{
+				result = victim.tasks.back();
+				victim.tasks.pop_back();
+			}
+			else
+			{
+				result = victim.tasks.front();
+				victim.tasks.pop_front();
+			}
+
+			pending_.fetch_sub(1, std::memory_order_relaxed);
+			return result;
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Runs pending tasks until stop is requested.
+	 *
+	 * @param stop  Stop token of the worker
+	 * @param index Index of the queue owned by the worker
+	 */
+	void work(std::stop_token stop, size_type index)
+	{
+		current_pool_ = this;
+		current_index_ = index;
+
+		while (!stop.stop_requested())
+		{
+			if (auto *pending = take(index))
+			{
+				pending->run();
+				continue;
+			}
+
+			const auto epoch = epoch_.load(std::memory_order_acquire);
+			if (pending_.load(std::memory_order_acquire) == 0 && !stop.stop_requested())
+			{
+				epoch_.wait(epoch, std::memory_order_acquire);
+			}
+		}
+	}
+public:
+	/**
+	 * Starts the workers.
+	 *
+	 * @param threads Number of worker threads, zero runs every task on the thread that waits for it
+	 */
+	[[nodiscard]] explicit thread_pool(size_type threads = std::thread::hardware_concurrency())
+	{
+		for (size_type i = 0; i <= threads; ++i)
+		{
+			queues_.push_back(std::make_unique<queue>());
+		}
+
+		for (size_type i = 0; i < threads; ++i)
+		{
+			workers_.emplace_back([this, i](std::stop_token stop) { work(std::move(stop), i); });
+		}
+	}
+
+	thread_pool(const thread_pool &) = delete;
+	thread_pool &operator=(const thread_pool &) = delete;
+
+	~thread_pool()
+	{
+		for (auto &worker : workers_)
+		{
+			worker.request_stop();
+		}
+
+		epoch_.fetch_add(1, std::memory_order_release);
+		epoch_.notify_all();
+
+		workers_.clear();
+	}
+
+	/**
+	 * Gets the pool shared by the whole process.
+	 *
+	 * @return Shared pointer to the global pool
+	 */
+	[[nodiscard]] static std::shared_ptr<thread_pool> global()
+	{
+		auto &instance = global_instance();
+
+		if (auto pool = instance.load(std::memory_order_acquire))
+		{
+			return pool;
+		}
+
+		std::shared_ptr<thread_pool> expected{};
+		auto pool = std::make_shared<thread_pool>();
+
+		if (!instance.compare_exchange_strong(expected, pool, std::memory_order_acq_rel))
+		{
+			return expected;
+		}
+
+		return pool;
+	}
+
+	/**
+	 * Replaces the pool shared by the whole process.
+	 *
+	 * @param threads Number of worker threads of the new pool
+	 *
+	 * @note Computations that already run on the previous pool finish on it.
+	 */
+	static void set_global_threads(size_type threads)
+	{
+		global_instance().store(std::make_shared<thread_pool>(threads), std::memory_order_release);
+	}
+
+	/**
+	 * Gets the number of threads that run the tasks, including the waiting one.
+	 *
+	 * @return Number of threads
+	 */
+	[[nodiscard]] size_type concurrency() const noexcept
+	{
+		return std::ranges::size(workers_) + 1;
+	}
+
+	/**
+	 * Submits a task to the queue of the calling thread.
+	 *
+	 * @param pending Task, must outlive its completion
+	 */
+	void submit(task &pending)
+	{
+		auto &target = *queues_[own_queue()];
+
+		pending_.fetch_add(1, std::memory_order_release);
+		{
+			std::scoped_lock lock(target.mutex);
+			target.tasks.push_back(&pending);
+		}
+
+		epoch_.fetch_add(1, std::memory_order_release);
+		epoch_.notify_one();
+	}
+
+	/**
+	 * Waits for a task, running other pending tasks meanwhile.
+	 *
+	 * @param pending Submitted task
+	 *
+	 * @throws The exception thrown by the task, if any
+	 */
+	void wait(task &pending)
+	{
+		const auto index = own_queue();
+
+		while (!pending.done())
+		{
+			if (auto *other = take(index))
+			{
+				other->run();
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		if (pending.error_)
+		{
+			std::rethrow_exception(pending.error_);
+		}
+	}
+private:
+	[[nodiscard]] static std::atomic<std::shared_ptr<thread_pool>> &global_instance() noexcept
+	{
+		static std::atomic<std::shared_ptr<thread_pool>> instance;
+		return instance;
+	}
+};
+
+/**
+ * Set of tasks forked from one scope and joined before leaving it.
+ */
+class task_group
+{
+	thread_pool &pool_;
+	std::vector<std::unique_ptr<task>> tasks_;
+public:
+	[[nodiscard]] explicit task_group(thread_pool &pool) noexcept : pool_(pool)
+	{
+	}
+
+	task_group(const task_group &) = delete;
+	task_group &operator=(const task_group &) = delete;
+
+	/**
+	 * Waits for the remaining tasks, discarding their exceptions.
+	 */
+	~task_group()
+	{
+		for (auto &pending : tasks_)
+		{
+			try
+			{
+				pool_.wait(*pending);
+			}
+			catch (...)
+			{
+			}
+		}
+	}
+
+	/**
+	 * Forks a task.
+	 *
+	 * @param work Callable, may run on any thread of the pool
+	 */
+	void run(std::function<void()> work)
+	{
+		tasks_.push_back(std::make_unique<task>(std::move(work)));
+		pool_.submit(*tasks_.back());
+	}
+
+	/**
+	 * Joins every forked task.
+	 *
+	 * @throws The first exception thrown by the tasks, if any
+	 */
+	void wait()
+	{
+		std::exception_ptr error;
+
+		for (auto &pending : tasks_)
+		{
+			try
+			{
+				pool_.wait(*pending);
+			}
+			catch (...)
+			{
+				if (!error)
+				{
+					error = std::current_exception();
+				}
+			}
+		}
+
+		tasks_.clear();
+
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+};
+}
@@ -2,6 +2,7 @@
 #include <sstream>
 #include "integer.hpp"
 #include "../numeric/numeric.hpp"
+#include "../parse/decimal.hpp"
 
 
 namespace big
@@ -15,4 +16,35 @@ std::ostream &operator<<(std::ostream &out, const integer &num)
 
 	return out << numeric::abs(num);
 }
+
+std::istream &operator>>(std::istream &in, integer &num)
+{
+	const std::istream::sentry sentry(in);
+	if (!sentry)
+	{
+		return in;
+	}
+
+	auto &buffer = *in.rdbuf();
+	const auto sign = buffer.sgetc();
+
+	const bool negative = sign == '-';
+	if (negative || sign == '+')
+	{
+		buffer.sbumpc();
+	}
+
+	parse::decimal_parser parser;
+	if (parse::read_decimal(in, parser) == 0)
+	{
+		in.setstate(std::ios::failbit);
+		return in;
+	}
+
+	auto abs = std::move(parser).finish();
+	const bool is_negative = negative && !abs.is_zero();
+	num = integer(std::move(abs), is_negative);
+
+	return in;
+}
 }
@@ -298,6 +298,13 @@ public:
 
 	friend std::ostream &operator<<(std::ostream &out, const integer &num);
 
+	/**
+	 * Reads a decimal number with an optional sign.
+	 *
+	 * @note Sets `failbit` and leaves `num` unchanged if the stream does not continue with a number.
+	 */
+	friend std::istream &operator>>(std::istream &in, integer &num);
+
 	template <std::integral T>
 	[[nodiscard]] explicit operator T() const & noexcept
 	{
@@ -305,3 +312,13 @@ public:
 	}
 };
 }
+
+template <>
+struct std::hash<big::integer>
+{
+	[[nodiscard]] constexpr std::size_t operator()(const big::integer &value) const noexcept
+	{
+		// zeroes of both signs hash alike, as they are the same number
+		return big::detail::hash_combine(std::hash<big::natural>{}(value.abs()), value.sign_bit() && !value.is_zero());
+	}
+};
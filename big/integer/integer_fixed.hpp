@@ -0,0 +1,247 @@
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include "../natural/natural_fixed.hpp"
+#include "../conv/stringifiable.hpp"
+
+
+namespace big
+{
+/**
+ * Integer number of a fixed capacity, stored as a `natural_fixed` absolute value and a sign bit.
+ *
+ * The division truncates towards zero and the remainder has the sign of the
+ * dividend, as for `integer`. Absolute values that do not fit are truncated
+ * modulo `natural_fixed<N>::number_system_base` to the power of `N`.
+ *
+ * @tparam N Number of limbs of the absolute value
+ */
+template <std::size_t N>
+	requires (N > 0)
+class integer_fixed : public conv::stringifiable<integer_fixed<N>>
+{
+	natural_fixed<N> abs_;
+	bool sign_bit_ = false;
+
+	/**
+	 * If `abs_` is zero, sets `sign_bit_` to `false`.
+	 */
+	constexpr void normalize() & noexcept
+	{
+		if (is_zero())
+		{
+			sign_bit_ = false;
+		}
+	}
+
+	/**
+	 * Adds the absolute value of other number if `same_sign` is set,
+	 * otherwise sets the absolute value to the distance between the two.
+	 *
+	 * @param other     Other number
+	 * @param same_sign Whether the absolute values are added
+	 *
+	 * @return Reference to the instance
+	 */
+	constexpr integer_fixed &add(const integer_fixed &other, bool same_sign) & noexcept
+	{
+		if (same_sign)
+		{
+			abs_ += other.abs_;
+		}
+		else
+		if (abs_ < other.abs_)
+		{
+			sign_bit_ = !sign_bit_;
+			abs_ = other.abs_ - abs_;
+		}
+		else
+		{
+			abs_ -= other.abs_;
+		}
+
+		normalize();
+		return *this;
+	}
+public:
+	/**
+	 * Constructs zero.
+	 */
+	[[nodiscard]] constexpr integer_fixed() noexcept = default;
+
+	template <std::integral T>
+	[[nodiscard]] constexpr integer_fixed(T value) noexcept
+		: abs_(value)
+		, sign_bit_(value < T{})
+	{
+	}
+
+	[[nodiscard]] constexpr integer_fixed(const natural_fixed<N> &abs, bool negative = false) noexcept
+		: abs_(abs)
+		, sign_bit_(negative)
+	{
+		normalize();
+	}
+
+	[[nodiscard]] constexpr bool sign_bit() const noexcept
+	{
+		return sign_bit_;
+	}
+
+	constexpr void flip_sign() & noexcept
+	{
+		sign_bit_ = !sign_bit_;
+		normalize();
+	}
+
+	[[nodiscard]] constexpr const natural_fixed<N> &abs() const noexcept
+	{
+		return abs_;
+	}
+
+	[[nodiscard]] constexpr bool is_zero() const noexcept
+	{
+		return abs_.is_zero();
+	}
+
+	[[nodiscard]] friend constexpr std::strong_ordering operator<=>(const integer_fixed &lhs, const integer_fixed &rhs) noexcept
+	{
+		if (lhs.sign_bit_ != rhs.sign_bit_)
+		{
+			return lhs.sign_bit_ ? std::strong_ordering::less : std::strong_ordering::greater;
+		}
+
+		return lhs.sign_bit_ ? rhs.abs_ <=> lhs.abs_ : lhs.abs_ <=> rhs.abs_;
+	}
+
+	[[nodiscard]] friend constexpr bool operator==(const integer_fixed &lhs, const integer_fixed &rhs) noexcept
+	{
+		return lhs.sign_bit_ == rhs.sign_bit_ && lhs.abs_ == rhs.abs_;
+	}
+
+	[[nodiscard]] constexpr integer_fixed operator+() const noexcept
+	{
+		return *this;
+	}
+
+	[[nodiscard]] constexpr integer_fixed operator-() const noexcept
+	{
+		return {abs_, !sign_bit_};
+	}
+
+	constexpr integer_fixed &operator++() & noexcept
+	{
+		return *this += 1;
+	}
+
+	constexpr integer_fixed operator++(int) & noexcept
+	{
+		integer_fixed tmp(*this);
+		++*this;
+		return tmp;
+	}
+
+	constexpr integer_fixed &operator--() & noexcept
+	{
+		return *this -= 1;
+	}
+
+	constexpr integer_fixed operator--(int) & noexcept
+	{
+		integer_fixed tmp(*this);
+		--*this;
+		return tmp;
+	}
+
+	constexpr integer_fixed &operator+=(const integer_fixed &other) & noexcept
+	{
+		return add(other, sign_bit_ == other.sign_bit_);
+	}
+
+	constexpr integer_fixed &operator-=(const integer_fixed &other) & noexcept
+	{
+		return add(other, sign_bit_ != other.sign_bit_);
+	}
+
+	constexpr integer_fixed &operator*=(const integer_fixed &other) & noexcept
+	{
+		sign_bit_ ^= other.sign_bit_;
+		abs_ *= other.abs_;
+		normalize();
+
+		return *this;
+	}
+
+	/**
+	 * @note This member function expects `other` to be not zero.
+	 */
+	constexpr integer_fixed &operator/=(const integer_fixed &other) & noexcept
+	{
+		sign_bit_ ^= other.sign_bit_;
+		abs_ /= other.abs_;
+		normalize();
+
+		return *this;
+	}
+
+	/**
+	 * @note This member function expects `other` to be not zero.
+	 */
+	constexpr integer_fixed &operator%=(const integer_fixed &other) & noexcept
+	{
+		abs_ %= other.abs_;
+		normalize();
+
+		return *this;
+	}
+
+	[[nodiscard]] constexpr integer_fixed operator+(const integer_fixed &other) const noexcept
+	{
+		integer_fixed tmp(*this);
+		tmp += other;
+		return tmp;
+	}
+
+	[[nodiscard]] constexpr integer_fixed operator-(const integer_fixed &other) const noexcept
+	{
+		integer_fixed tmp(*this);
+		tmp -= other;
+		return tmp;
+	}
+
+	[[nodiscard]] constexpr integer_fixed operator*(const integer_fixed &other) const noexcept
+	{
+		integer_fixed tmp(*this);
+		tmp *= other;
+		return tmp;
+	}
+
+	[[nodiscard]] constexpr integer_fixed operator/(const integer_fixed &other) const noexcept
+	{
+		integer_fixed tmp(*this);
+		tmp /= other;
+		return tmp;
+	}
+
+	[[nodiscard]] constexpr integer_fixed operator%(const integer_fixed &other) const noexcept
+	{
+		integer_fixed tmp(*this);
+		tmp %= other;
+		return tmp;
+	}
+
+	friend std::ostream &operator<<(std::ostream &out, const integer_fixed &num)
+	{
+		if (num.sign_bit_)
+		{
+			out << '-';
+		}
+
+		return out << num.abs_;
+	}
+};
+}
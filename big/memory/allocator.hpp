@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "limb_pool.hpp"
+
+
+namespace big::memory
+{
+/**
+ * Alignment of the storage of numbers and coefficients, the size of a cache line.
+ */
+inline constexpr std::size_t storage_alignment = 64;
+
+namespace detail
+{
+/**
+ * Resource of the calling thread, overrides the default one while set.
+ */
+inline constinit thread_local std::pmr::memory_resource *thread_resource = nullptr;
+
+/**
+ * Process-wide default resource, the global limb pool if not set.
+ */
+inline constinit std::atomic<std::pmr::memory_resource *> default_resource = nullptr;
+}
+
+/**
+ * Gets the memory resource numbers allocate from by default.
+ *
+ * @return Default resource, the global `limb_pool_resource` initially
+ */
+[[nodiscard]] inline std::pmr::memory_resource *default_resource() noexcept
+{
+	auto *resource = detail::default_resource.load(std::memory_order_acquire);
+	return resource != nullptr ? resource : &limb_pool_resource::global();
+}
+
+/**
+ * Sets the memory resource numbers allocate from by default.
+ *
+ * @param resource Resource, must outlive every number allocated from it, `nullptr` for the global limb pool
+ *
+ * @return Previous default resource
+ */
+inline std::pmr::memory_resource *set_default_resource(std::pmr::memory_resource *resource) noexcept
+{
+	auto *previous = detail::default_resource.exchange(resource, std::memory_order_acq_rel);
+	return previous != nullptr ? previous : &limb_pool_resource::global();
+}
+
+/**
+ * Gets the memory resource newly created numbers allocate from.
+ *
+ * @return Resource of the innermost `scoped_resource` of the calling thread, `default_resource()` otherwise
+ */
+[[nodiscard]] inline std::pmr::memory_resource *current_resource() noexcept
+{
+	return detail::thread_resource != nullptr ? detail::thread_resource : default_resource();
+}
+
+/**
+ * Makes the calling thread allocate new numbers from the given resource for the lifetime of the object.
+ *
+ * @note The numbers created in the scope must not outlive the resource.
+ *       Copies made outside of the scope allocate from the resource current at that time.
+ */
+class scoped_resource
+{
+	std::pmr::memory_resource *previous_;
+public:
+	[[nodiscard]] explicit scoped_resource(std::pmr::memory_resource *resource) noexcept
+		: previous_(std::exchange(detail::thread_resource, resource))
+	{
+	}
+
+	scoped_resource(const scoped_resource &) = delete;
+	scoped_resource &operator=(const scoped_resource &) = delete;
+
+	~scoped_resource()
+	{
+		detail::thread_resource = previous_;
+	}
+};
+
+/**
+ * Creates a value bound to the default resource, whatever the scoped resource of the calling thread.
+ *
+ * Values that tasks on other threads grow or assign to must be created this way,
+ * as a scoped resource, a monotonic arena for instance, need not be thread-safe.
+ *
+ * @tparam T    Value type
+ * @tparam Args Argument types
+ *
+ * @param args Arguments of the constructor
+ *
+ * @return Value constructed from `args`
+ */
+template <typename T, typename... Args>
+[[nodiscard]] T make_unscoped(Args &&...args)
+{
+	scoped_resource scope(default_resource());
+	return T(std::forward<Args>(args)...);
+}
+
+/**
+ * Allocator of cache-line-aligned storage from a polymorphic memory resource.
+ *
+ * Allocations of at least a cache line are aligned to `storage_alignment`,
+ * so that vectorized loops over the limbs never straddle cache lines.
+ * Unlike `std::pmr::polymorphic_allocator`, it stays usable in constant
+ * evaluation, where it falls back to `std::allocator`. Like it, the resource
+ * is bound on construction and is not propagated on copy, move or swap.
+ *
+ * @tparam T Value type
+ */
+template <typename T>
+class aligned_allocator
+{
+	template <typename U>
+	friend class aligned_allocator;
+
+	std::pmr::memory_resource *resource_ = nullptr;
+
+	/**
+	 * Gets the alignment of an allocation, storage smaller than a cache line is only aligned for `T`.
+	 *
+	 * @param n Number of elements
+	 */
+	[[nodiscard]] static constexpr std::size_t alignment(std::size_t n) noexcept
+	{
+		return n * sizeof(T) < storage_alignment ? alignof(T) : std::max(storage_alignment, alignof(T));
+	}
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::false_type;
+	using propagate_on_container_swap = std::false_type;
+	using is_always_equal = std::false_type;
+
+	/**
+	 * Binds the allocator to the current resource of the calling thread.
+	 */
+	[[nodiscard]] constexpr aligned_allocator() noexcept
+	{
+		if (!std::is_constant_evaluated())
+		{
+			resource_ = current_resource();
+		}
+	}
+
+	/**
+	 * Binds the allocator to the given resource.
+	 *
+	 * @param resource Memory resource, must outlive the allocations
+	 */
+	[[nodiscard]] constexpr aligned_allocator(std::pmr::memory_resource *resource) noexcept : resource_(resource)
+	{
+	}
+
+	template <typename U>
+	[[nodiscard]] constexpr aligned_allocator(const aligned_allocator<U> &other) noexcept : resource_(other.resource_)
+	{
+	}
+
+	/**
+	 * Gets the resource the allocator is bound to.
+	 *
+	 * @return Memory resource
+	 */
+	[[nodiscard]] std::pmr::memory_resource *resource() const noexcept
+	{
+		return resource_;
+	}
+
+	[[nodiscard]] constexpr T *allocate(std::size_t n)
+	{
+		if (std::is_constant_evaluated())
+		{
+			return std::allocator<T>{}.allocate(n);
+		}
+
+		if (n > std::allocator_traits<std::allocator<T>>::max_size(std::allocator<T>{}))
+		{
+			throw std::bad_array_new_length();
+		}
+
+		return static_cast<T *>(resource_->allocate(n * sizeof(T), alignment(n)));
+	}
+
+	constexpr void deallocate(T *p, std::size_t n) noexcept
+	{
+		if (std::is_constant_evaluated())
+		{
+			return std::allocator<T>{}.deallocate(p, n);
+		}
+
+		resource_->deallocate(p, n * sizeof(T), alignment(n));
+	}
+
+	/**
+	 * Gets the allocator of a container copy, bound to the current resource of the calling thread.
+	 */
+	[[nodiscard]] constexpr aligned_allocator select_on_container_copy_construction() const noexcept
+	{
+		return {};
+	}
+
+	template <typename U>
+	[[nodiscard]] constexpr bool operator==(const aligned_allocator<U> &other) const noexcept
+	{
+		return resource_ == other.resource_ || (resource_ != nullptr && other.resource_ != nullptr && resource_->is_equal(*other.resource_));
+	}
+};
+}
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+
+namespace big::memory
+{
+/**
+ * Memory resource that recycles freed blocks through caches local to every thread.
+ *
+ * Requests up to `max_block_size` bytes are rounded up to a power of two, and
+ * freed blocks are kept in the cache of the freeing thread, one stack per size
+ * class, to be handed out again without touching the upstream resource. Larger
+ * requests and blocks that exceed the caps of the cache go to the upstream.
+ *
+ * @note Every thread that used the resource must exit or call `release_thread_cache`
+ *       before the resource is destroyed.
+ */
+class limb_pool_resource : public std::pmr::memory_resource
+{
+public:
+	using size_type = std::size_t;
+
+	static constexpr size_type min_block_size = 64;
+	static constexpr size_type max_block_size = size_type{1} << 20;
+	static constexpr size_type class_count = std::bit_width(max_block_size / min_block_size);
+	static constexpr size_type block_alignment = 64;
+
+	static constexpr size_type default_max_blocks = 64;
+	static constexpr size_type default_max_bytes = size_type{8} << 20;
+
+	/**
+	 * Counters of the cache of a thread.
+	 */
+	struct statistics
+	{
+		// allocations served from the cache
+		size_type hits = 0;
+		// allocations of pooled sizes served by the upstream
+		size_type misses = 0;
+		// allocations above the largest size class
+		size_type oversized = 0;
+		// freed blocks kept in the cache
+		size_type recycled = 0;
+		// freed blocks returned to the upstream because of the caps
+		size_type released = 0;
+		// total size of the blocks in the cache
+		size_type cached_bytes = 0;
+	};
+private:
+	struct thread_cache
+	{
+		// identifier of the owning resource, which is never reused unlike its address
+		std::uint64_t owner;
+		std::pmr::memory_resource *upstream;
+		std::array<std::vector<void *>, class_count> blocks{};
+		statistics stats{};
+
+		thread_cache(std::uint64_t owner, std::pmr::memory_resource *upstream) noexcept
+			: owner(owner), upstream(upstream)
+		{
+		}
+
+		thread_cache(const thread_cache &) = delete;
+		thread_cache &operator=(const thread_cache &) = delete;
+
+		void release() noexcept
+		{
+			for (size_type i = 0; i < class_count; ++i)
+			{
+				for (auto *block : blocks[i])
+				{
+					upstream->deallocate(block, class_size(i), block_alignment);
+				}
+
+				blocks[i].clear();
+			}
+
+			stats.cached_bytes = 0;
+		}
+
+		~thread_cache()
+		{
+			release();
+		}
+	};
+
+	struct thread_caches
+	{
+		std::vector<std::unique_ptr<thread_cache>> entries;
+
+		~thread_caches()
+		{
+			entries.clear();
+			destroyed = true;
+		}
+
+		// blocks freed by the destructors of static objects after the thread has ended go to the upstream
+		inline static constinit thread_local bool destroyed = false;
+	};
+
+	inline static thread_local thread_caches caches_;
+	inline static constinit std::atomic<std::uint64_t> next_id_{0};
+
+	const std::uint64_t id_ = next_id_.fetch_add(1, std::memory_order_relaxed);
+	std::pmr::memory_resource *upstream_;
+	std::atomic<size_type> max_blocks_{default_max_blocks};
+	std::atomic<size_type> max_bytes_{default_max_bytes};
+
+	[[nodiscard]] static constexpr size_type class_size(size_type index) noexcept
+	{
+		return min_block_size << index;
+	}
+
+	[[nodiscard]] static constexpr size_type class_of(size_type bytes) noexcept
+	{
+		return std::bit_width((std::max(bytes, min_block_size) - 1) / min_block_size);
+	}
+
+	[[nodiscard]] static constexpr bool is_pooled(size_type bytes, size_type alignment) noexcept
+	{
+		return bytes <= max_block_size && alignment <= block_alignment;
+	}
+
+	/**
+	 * Gets the cache of the calling thread, creating it on first use.
+	 *
+	 * @return Pointer to the cache, `nullptr` if the caches of the thread are already destroyed
+	 */
+	[[nodiscard]] thread_cache *cache() const
+	{
+		if (thread_caches::destroyed)
+		{
+			return nullptr;
+		}
+
+		for (auto &entry : caches_.entries)
+		{
+			if (entry->owner == id_)
+			{
+				return entry.get();
+			}
+		}
+
+		return caches_.entries.emplace_back(std::make_unique<thread_cache>(id_, upstream_)).get();
+	}
+
+	void *do_allocate(size_type bytes, size_type alignment) override
+	{
+		if (!is_pooled(bytes, alignment))
+		{
+			if (auto *local = cache())
+			{
+				++local->stats.oversized;
+			}
+
+			return upstream_->allocate(bytes, alignment);
+		}
+
+		const auto index = class_of(bytes);
+		auto *local = cache();
+
+		if (local == nullptr || local->blocks[index].empty())
+		{
+			if (local != nullptr)
+			{
+				++local->stats.misses;
+			}
+
+			return upstream_->allocate(class_size(index), block_alignment);
+		}
+
+		auto &stack = local->blocks[index];
+		auto *block = stack.back();
+		stack.pop_back();
+
+		++local->stats.hits;
+		local->stats.cached_bytes -= class_size(index);
+
+		return block;
+	}
+
+	void do_deallocate(void *p, size_type bytes, size_type alignment) override
+	{
+		if (!is_pooled(bytes, alignment))
+		{
+			return upstream_->deallocate(p, bytes, alignment);
+		}
+
+		const auto index = class_of(bytes);
+		const auto size = class_size(index);
+		auto *local = cache();
+
+		if (local == nullptr
+			|| std::ranges::size(local->blocks[index]) >= max_blocks_.load(std::memory_order_relaxed)
+			|| local->stats.cached_bytes + size > max_bytes_.load(std::memory_order_relaxed))
+		{
+			if (local != nullptr)
+			{
+				++local->stats.released;
+			}
+
+			return upstream_->deallocate(p, size, block_alignment);
+		}
+
+		local->blocks[index].push_back(p);
+
+		++local->stats.recycled;
+		local->stats.cached_bytes += size;
+	}
+
+	[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+public:
+	/**
+	 * Constructs the resource.
+	 *
+	 * @param upstream Resource the blocks are allocated from, must be thread-safe
+	 */
+	[[nodiscard]] explicit limb_pool_resource(std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) noexcept
+		: upstream_(upstream)
+	{
+	}
+
+	limb_pool_resource(const limb_pool_resource &) = delete;
+	limb_pool_resource &operator=(const limb_pool_resource &) = delete;
+
+	~limb_pool_resource() override
+	{
+		release_thread_cache();
+	}
+
+	/**
+	 * Gets the resource shared by the whole process.
+	 *
+	 * @return Reference to the global resource
+	 *
+	 * @note The global resource is never destroyed, so that the caches of
+	 *       threads exiting during the process shutdown can be released.
+	 */
+	[[nodiscard]] static limb_pool_resource &global() noexcept
+	{
+		static auto *resource = new limb_pool_resource();
+		return *resource;
+	}
+
+	/**
+	 * Gets the upstream resource.
+	 *
+	 * @return Upstream resource
+	 */
+	[[nodiscard]] std::pmr::memory_resource *upstream() const noexcept
+	{
+		return upstream_;
+	}
+
+	/**
+	 * Gets the largest number of cached blocks of a size class in a thread.
+	 *
+	 * @return Number of blocks
+	 */
+	[[nodiscard]] size_type max_blocks() const noexcept
+	{
+		return max_blocks_.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Sets the largest number of cached blocks of a size class in a thread.
+	 *
+	 * @param blocks Number of blocks, zero disables caching
+	 *
+	 * @note Lowering the cap does not release blocks that are already cached.
+	 */
+	void set_max_blocks(size_type blocks) noexcept
+	{
+		max_blocks_.store(blocks, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Gets the largest total size of the cached blocks in a thread.
+	 *
+	 * @return Size in bytes
+	 */
+	[[nodiscard]] size_type max_bytes() const noexcept
+	{
+		return max_bytes_.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Sets the largest total size of the cached blocks in a thread.
+	 *
+	 * @param bytes Size in bytes
+	 *
+	 * @note Lowering the cap does not release blocks that are already cached.
+	 */
+	void set_max_bytes(size_type bytes) noexcept
+	{
+		max_bytes_.store(bytes, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Gets the counters of the cache of the calling thread.
+	 *
+	 * @return Statistics
+	 */
+	[[nodiscard]] statistics thread_statistics() const
+	{
+		const auto *local = cache();
+		return local != nullptr ? local->stats : statistics{};
+	}
+
+	/**
+	 * Returns every block cached by the calling thread to the upstream and drops the cache.
+	 *
+	 * @note The counters of the thread start from zero again.
+	 */
+	void release_thread_cache() noexcept
+	{
+		if (thread_caches::destroyed)
+		{
+			return;
+		}
+
+		std::erase_if(caches_.entries, [this](const auto &entry) { return entry->owner == id_; });
+	}
+};
+}
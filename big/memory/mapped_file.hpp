@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace big::memory
+{
+/**
+ * Read-only mapping of a whole file.
+ */
+class mapped_file
+{
+	const std::byte *data_ = nullptr;
+	std::size_t size_ = 0;
+public:
+	[[nodiscard]] mapped_file() noexcept = default;
+
+	/**
+	 * Maps a file.
+	 *
+	 * @param path Path of the file
+	 *
+	 * @throws `std::system_error` if the file cannot be opened or mapped
+	 */
+	[[nodiscard]] explicit mapped_file(const std::filesystem::path &path)
+	{
+		const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+		{
+			throw std::system_error(errno, std::generic_category(), "cannot open " + path.string());
+		}
+
+		struct stat status{};
+		if (::fstat(fd, &status) != 0)
+		{
+			const auto error = errno;
+			::close(fd);
+			throw std::system_error(error, std::generic_category(), "cannot stat " + path.string());
+		}
+
+		size_ = static_cast<std::size_t>(status.st_size);
+		if (size_ != 0)
+		{
+			void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data == MAP_FAILED)
+			{
+				const auto error = errno;
+				::close(fd);
+				throw std::system_error(error, std::generic_category(), "cannot map " + path.string());
+			}
+
+			data_ = static_cast<const std::byte *>(data);
+		}
+
+		// the mapping stays valid after the descriptor is closed
+		::close(fd);
+	}
+
+	mapped_file(mapped_file &&other) noexcept
+		: data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+	{
+	}
+
+	mapped_file &operator=(mapped_file &&other) noexcept
+	{
+		if (this != &other)
+		{
+			unmap();
+			data_ = std::exchange(other.data_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+		}
+
+		return *this;
+	}
+
+	~mapped_file()
+	{
+		unmap();
+	}
+
+	void unmap() noexcept
+	{
+		if (data_ != nullptr)
+		{
+			::munmap(const_cast<std::byte *>(data_), size_);
+			data_ = nullptr;
+			size_ = 0;
+		}
+	}
+
+	/**
+	 * Hints that the mapping is going to be read front to back, so that it is read ahead aggressively.
+	 */
+	void advise_sequential() const noexcept
+	{
+		if (data_ != nullptr)
+		{
+			::madvise(const_cast<std::byte *>(data_), size_, MADV_SEQUENTIAL);
+		}
+	}
+
+	[[nodiscard]] std::span<const std::byte> bytes() const noexcept
+	{
+		return {data_, size_};
+	}
+};
+}
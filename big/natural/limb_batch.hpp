@@ -0,0 +1,425 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "natural.hpp"
+
+
+namespace big
+{
+/**
+ * Largest limb count of the batches that `with_limb_count` dispatches to.
+ */
+inline constexpr std::size_t max_batch_limbs = 8;
+
+/**
+ * Batch of natural numbers of at most `N` limbs in a structure-of-arrays layout.
+ *
+ * Limb `k` of every element is stored in lane `k`, so the batch kernels run
+ * the same operation over consecutive elements of a lane, in loops without
+ * branches or allocations that compilers can vectorize. Shorter elements are
+ * padded with zero limbs.
+ *
+ * @tparam N Number of limbs of an element
+ */
+template <std::size_t N>
+	requires (N > 0)
+class limb_batch
+{
+public:
+	using digit_type = natural::digit_type;
+	using size_type = std::size_t;
+	using lane_type = natural::digits_type;
+
+	static constexpr size_type limbs = N;
+private:
+	std::array<lane_type, N> lanes_{};
+public:
+	[[nodiscard]] limb_batch() = default;
+
+	/**
+	 * Constructs a batch of zeroes.
+	 *
+	 * @param size Number of elements
+	 */
+	[[nodiscard]] explicit limb_batch(size_type size)
+	{
+		resize(size);
+	}
+
+	/**
+	 * Constructs the batch from a range of numbers.
+	 *
+	 * @tparam R Range type
+	 *
+	 * @param values Numbers of at most `N` limbs
+	 *
+	 * @throws `std::length_error` if a number has more than `N` limbs
+	 */
+	template <std::ranges::input_range R>
+		requires std::convertible_to<std::ranges::range_reference_t<R>, natural_view>
+	[[nodiscard]] explicit limb_batch(R &&values)
+	{
+		for (const natural_view value : values)
+		{
+			push_back(value);
+		}
+	}
+
+	[[nodiscard]] size_type size() const noexcept
+	{
+		return std::ranges::size(lanes_[0]);
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	void resize(size_type size)
+	{
+		for (auto &lane : lanes_)
+		{
+			lane.resize(size);
+		}
+	}
+
+	void reserve(size_type size)
+	{
+		for (auto &lane : lanes_)
+		{
+			lane.reserve(size);
+		}
+	}
+
+	/**
+	 * Gets the limbs of the elements at a position.
+	 *
+	 * @param k Position of the limbs, starting from the least significant one
+	 *
+	 * @return Lane of the limbs
+	 */
+	[[nodiscard]] const lane_type &lane(size_type k) const noexcept
+	{
+		return lanes_[k];
+	}
+
+	[[nodiscard]] lane_type &lane(size_type k) noexcept
+	{
+		return lanes_[k];
+	}
+
+	/**
+	 * Replaces an element.
+	 *
+	 * @param index Index of the element
+	 * @param value Number of at most `N` limbs
+	 *
+	 * @throws `std::length_error` if `value` has more than `N` limbs
+	 */
+	void store(size_type index, natural_view value)
+	{
+		if (value.size() > N)
+		{
+			throw std::length_error("a number of " + std::to_string(value.size())
+				+ " limbs does not fit into a batch of " + std::to_string(N) + " limbs");
+		}
+
+		for (size_type k = 0; k < N; ++k)
+		{
+			lanes_[k][index] = k < value.size() ? value[k] : 0;
+		}
+	}
+
+	void push_back(natural_view value)
+	{
+		resize(size() + 1);
+
+		try
+		{
+			store(size() - 1, value);
+		}
+		catch (...)
+		{
+			resize(size() - 1);
+			throw;
+		}
+	}
+
+	/**
+	 * Copies an element out of the batch.
+	 *
+	 * @param index Index of the element
+	 *
+	 * @return Number
+	 */
+	[[nodiscard]] natural operator[](size_type index) const
+	{
+		natural::digits_type digits(N);
+		for (size_type k = 0; k < N; ++k)
+		{
+			digits[k] = lanes_[k][index];
+		}
+
+		return natural(std::move(digits));
+	}
+};
+
+namespace detail
+{
+template <std::size_t N, std::size_t M>
+void check_batch_sizes(const limb_batch<N> &lhs, const limb_batch<M> &rhs)
+{
+	if (lhs.size() != rhs.size())
+	{
+		throw std::invalid_argument("batches of " + std::to_string(lhs.size()) + " and "
+			+ std::to_string(rhs.size()) + " elements cannot be combined");
+	}
+}
+}
+
+/**
+ * Adds the elements of two batches pairwise.
+ *
+ * @param lhs Left-hand sides
+ * @param rhs Right-hand sides, as many as `lhs`
+ *
+ * @return Batch of the sums
+ *
+ * @throws `std::invalid_argument` if the batches have different sizes
+ */
+template <std::size_t N, std::size_t M>
+[[nodiscard]] limb_batch<std::max(N, M) + 1> batch_add(const limb_batch<N> &lhs, const limb_batch<M> &rhs)
+{
+	using digit_type = natural::digit_type;
+	constexpr auto base = natural::number_system_base;
+
+	detail::check_batch_sizes(lhs, rhs);
+
+	const auto size = lhs.size();
+	limb_batch<std::max(N, M) + 1> result(size);
+
+	// the carries are kept in the top lane of the result until they are consumed
+	auto &carries = result.lane(std::max(N, M));
+
+	for (std::size_t k = 0; k < std::max(N, M); ++k)
+	{
+		auto *out = result.lane(k).data();
+		auto *carry = carries.data();
+
+		if (k < N && k < M)
+		{
+			const auto *a = lhs.lane(k).data();
+			const auto *b = rhs.lane(k).data();
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const digit_type sum = a[i] + b[i] + carry[i];
+				carry[i] = sum >= base;
+				out[i] = sum - (sum >= base ? base : 0);
+			}
+		}
+		else
+		{
+			const auto *a = k < N ? lhs.lane(k).data() : rhs.lane(k).data();
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				const digit_type sum = a[i] + carry[i];
+				carry[i] = sum >= base;
+				out[i] = sum - (sum >= base ? base : 0);
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Multiplies the elements of two batches pairwise.
+ *
+ * Every limb of the products is found by summing a column of partial products
+ * in 64 bits, so a single carry is propagated per limb instead of per partial product.
+ *
+ * @param lhs Left-hand sides
+ * @param rhs Right-hand sides, as many as `lhs`
+ *
+ * @return Batch of the products
+ *
+ * @throws `std::invalid_argument` if the batches have different sizes
+ */
+template <std::size_t N, std::size_t M>
+	requires (std::min(N, M) <= 16)
+[[nodiscard]] limb_batch<N + M> batch_mul(const limb_batch<N> &lhs, const limb_batch<M> &rhs)
+{
+	using digit_type = natural::digit_type;
+	constexpr std::uint64_t base = natural::number_system_base;
+
+	detail::check_batch_sizes(lhs, rhs);
+
+	const auto size = lhs.size();
+	limb_batch<N + M> result(size);
+
+	// at most 16 partial products below `base^2` and a carry below `17 * base` fit in 64 bits
+	std::vector<std::uint64_t> carry(size);
+	std::vector<std::uint64_t> column(size);
+
+	for (std::size_t k = 0; k < N + M; ++k)
+	{
+		std::ranges::copy(carry, column.begin());
+
+		for (std::size_t j = k < M ? 0 : k - M + 1; j < N && j <= k; ++j)
+		{
+			const auto *a = lhs.lane(j).data();
+			const auto *b = rhs.lane(k - j).data();
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				column[i] += std::uint64_t{a[i]} * b[i];
+			}
+		}
+
+		auto *out = result.lane(k).data();
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			out[i] = static_cast<digit_type>(column[i] % base);
+			carry[i] = column[i] / base;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Finds the remainders of the elements of a batch by single-limb divisors.
+ *
+ * @param lhs Dividends
+ * @param rhs Divisors, as many as `lhs`, none of them zero
+ *
+ * @return Batch of the remainders
+ *
+ * @throws `std::invalid_argument` if the batches have different sizes
+ * @throws `std::domain_error` if a divisor is zero
+ */
+template <std::size_t N>
+[[nodiscard]] limb_batch<1> batch_mod(const limb_batch<N> &lhs, const limb_batch<1> &rhs)
+{
+	constexpr std::uint64_t base = natural::number_system_base;
+
+	detail::check_batch_sizes(lhs, rhs);
+
+	const auto size = lhs.size();
+	const auto *m = rhs.lane(0).data();
+
+	if (std::ranges::any_of(rhs.lane(0), [](auto divisor) { return divisor == 0; }))
+	{
+		throw std::domain_error("division by zero");
+	}
+
+	std::vector<std::uint64_t> remainder(size);
+	for (std::size_t k = N; k-- > 0;)
+	{
+		const auto *a = lhs.lane(k).data();
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			remainder[i] = (remainder[i] * base + a[i]) % m[i];
+		}
+	}
+
+	limb_batch<1> result(size);
+	std::ranges::copy(remainder, result.lane(0).begin());
+	return result;
+}
+
+/**
+ * Finds the remainders of the elements of two batches pairwise.
+ *
+ * @param lhs Dividends
+ * @param rhs Divisors, as many as `lhs`, none of them zero
+ *
+ * @return Batch of the remainders
+ *
+ * @throws `std::invalid_argument` if the batches have different sizes
+ * @throws `std::domain_error` if a divisor is zero
+ *
+ * @note Multi-limb divisors are divided one element at a time by the long division of natural.
+ */
+template <std::size_t N, std::size_t M>
+	requires (M > 1)
+[[nodiscard]] limb_batch<M> batch_mod(const limb_batch<N> &lhs, const limb_batch<M> &rhs)
+{
+	detail::check_batch_sizes(lhs, rhs);
+
+	limb_batch<M> result(lhs.size());
+	for (std::size_t i = 0; i < lhs.size(); ++i)
+	{
+		result.store(i, lhs[i] % rhs[i]);
+	}
+
+	return result;
+}
+
+/**
+ * Groups numbers by their limb counts, so that each group can be gathered into a batch.
+ *
+ * @tparam R Range type
+ *
+ * @param values Numbers
+ *
+ * @return Indices of the numbers of `k` limbs at position `k`, of longer numbers at position 0
+ */
+template <std::ranges::input_range R>
+	requires std::convertible_to<std::ranges::range_reference_t<R>, natural_view>
+[[nodiscard]] std::array<std::vector<std::size_t>, max_batch_limbs + 1> group_by_limb_count(R &&values)
+{
+	std::array<std::vector<std::size_t>, max_batch_limbs + 1> groups{};
+
+	std::size_t index = 0;
+	for (const natural_view value : values)
+	{
+		groups[value.size() <= max_batch_limbs ? value.size() : 0].push_back(index++);
+	}
+
+	return groups;
+}
+
+/**
+ * Calls a function with a limb count known at compile time.
+ *
+ * @tparam F Function type
+ *
+ * @param limbs Limb count, from 1 to `max_batch_limbs`
+ * @param f     Function called with `std::integral_constant<std::size_t, limbs>`
+ *
+ * @return Result of `f`
+ *
+ * @throws `std::out_of_range` if `limbs` is out of range
+ */
+template <typename F>
+decltype(auto) with_limb_count(std::size_t limbs, F &&f)
+{
+	if (limbs == 0 || limbs > max_batch_limbs)
+	{
+		throw std::out_of_range("batches of " + std::to_string(limbs) + " limbs are not supported");
+	}
+
+	return [&]<std::size_t... I>(std::index_sequence<I...>) -> decltype(auto)
+	{
+		using result_type = decltype(f(std::integral_constant<std::size_t, 1>{}));
+		if constexpr (std::is_void_v<result_type>)
+		{
+			static_cast<void>(((limbs == I + 1 ? (f(std::integral_constant<std::size_t, I + 1>{}), true) : false) || ...));
+		}
+		else
+		{
+			result_type result{};
+			static_cast<void>(((limbs == I + 1 ? (result = f(std::integral_constant<std::size_t, I + 1>{}), true) : false) || ...));
+			return result;
+		}
+	}(std::make_index_sequence<max_batch_limbs>{});
+}
+}
@@ -1,70 +1,72 @@
 #include <algorithm>
+#include <array>
 #include <ranges>
 #include <stdexcept>
 #include <sstream>
 #include <compare>
-#include <cmath>
-#include <iomanip>
 #include "natural.hpp"
+#include "../parse/decimal.hpp"
+#include "../conv/decimal.hpp"
 
 
 namespace big
 {
-natural::natural(std::string_view num)
+std::ostream &operator<<(std::ostream &out, natural_view num)
 {
-	if (num.empty())
-	{
-		throw std::invalid_argument("cannot build num from empty string");
-	}
+	const auto size = conv::decimal_size(num);
+	const auto width = static_cast<std::size_t>(std::max<std::streamsize>(out.width(0), 0));
+	const auto padding = width > size ? width - size : 0;
 
-	const auto &is_not_a_decimal_digit = [](const auto &ch)
+	const auto pad = [&out, padding]
 	{
-		return !std::isdigit(ch);
+		for (std::size_t i = 0; i < padding; ++i)
+		{
+			out.put(out.fill());
+		}
 	};
 
-	if (std::ranges::any_of(num, is_not_a_decimal_digit))
+	if ((out.flags() & std::ios::adjustfield) != std::ios::left)
 	{
-		throw std::invalid_argument("invalid number, one or more characters are not a digit");
+		pad();
 	}
 
-	const auto &chunk_size = bits_per_num;
-	auto current_chunk_size = std::ranges::size(num) % chunk_size;
-	if (current_chunk_size == 0)
+	std::array<char, 4096> block;
+	for (std::size_t first = 0; first < size; first += block.size())
 	{
-		current_chunk_size = chunk_size;
+		const auto count = std::min(block.size(), size - first);
+		conv::format_decimal(num, first, count, block.data());
+		out.write(block.data(), static_cast<std::streamsize>(count));
 	}
 
-	size_type offset = 0;
-	const size_type total_chunks = std::ceil(static_cast<double>(std::ranges::size(num)) / chunk_size);
-	for (size_type i = 0; i < total_chunks; ++i)
+	if ((out.flags() & std::ios::adjustfield) == std::ios::left)
 	{
-		auto chunk = num.substr(offset, current_chunk_size);
-
-		digit_type digit = std::strtoul(std::string(chunk.begin(), chunk.end()).data(), nullptr, 10);
-		digits_.insert(std::ranges::begin(digits_), digit);
-
-		offset += current_chunk_size;
-		current_chunk_size = chunk_size;
+		pad();
 	}
 
-	erase_leading_zeroes();
+	return out;
 }
 
 std::ostream &operator<<(std::ostream &out, const natural &num)
 {
-	const auto rbegin = std::ranges::rbegin(num.digits_);
-	const auto rend = std::ranges::rend(num.digits_);
+	return out << num.view();
+}
 
-	for (auto it = rbegin; it != rend; ++it)
+std::istream &operator>>(std::istream &in, natural &num)
+{
+	const std::istream::sentry sentry(in);
+	if (!sentry)
 	{
-		if (it != rbegin)
-		{
-			out << std::setw(natural::bits_per_num) << std::setfill('0');
-		}
+		return in;
+	}
 
-		out << *it;
+	parse::decimal_parser parser;
+	if (parse::read_decimal(in, parser) == 0)
+	{
+		in.setstate(std::ios::failbit);
+		return in;
 	}
 
-	return out;
+	num = std::move(parser).finish();
+	return in;
 }
 }
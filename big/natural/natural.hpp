@@ -7,9 +7,16 @@
 #include <ranges>
 #include <algorithm>
 #include <limits>
+#include <optional>
+#include <utility>
+#include <stdexcept>
+#include <string_view>
 
 #include "../algorithm/container.hpp"
 #include "../conv/stringifiable.hpp"
+#include "../execution/execution.hpp"
+#include "../memory/allocator.hpp"
+#include "natural_view.hpp"
 
 
 namespace big
@@ -21,12 +28,13 @@ class natural : public conv::stringifiable<natural>
 {
 public:
 	using digit_type = std::uint32_t;
-	using digits_type = std::vector<digit_type>;
+	using digits_type = std::vector<digit_type, memory::aligned_allocator<digit_type>>;
 	using size_type = std::size_t;
 
 	static constexpr const digit_type number_system_base = 1'000'000'000;
 	static constexpr const std::uint8_t bits_per_num = 9;
 	static constexpr const std::uint8_t karatsuba_threshold = 32;
+	static constexpr const std::size_t parallel_mul_threshold = 1024;
 private:
 	digits_type digits_;
 
@@ -128,30 +136,61 @@ private:
 	}
 
 	/**
-	 * Multiplies a number by a single digit.
+	 * Checks whether a view points into the digits of the number.
 	 *
-	 * @param digit Digit value
+	 * @param other View
 	 *
-	 * @return Reference to the instance
+	 * @return `true` if modifying the number may change `other`, `false` otherwise
+	 */
+	[[nodiscard]] constexpr bool overlaps(natural_view other) const noexcept
+	{
+		if (std::is_constant_evaluated())
+		{
+			// pointers into unrelated arrays cannot be compared during constant evaluation
+			return true;
+		}
+
+		const auto *begin = std::ranges::data(digits_);
+		const auto *data = std::ranges::data(other.digits());
+		return !std::less{}(data, begin) && std::less{}(data, begin + std::ranges::size(digits_));
+	}
+
+	/**
+	 * Adds a number that does not view the digits of this one.
 	 *
-	 * @note MUL_ND_N
+	 * @param other Summand, not a view of this number
+	 *
+	 * @return Reference to the instance
 	 */
-	[[nodiscard]] constexpr natural &mul_digit(const digit_type digit)
+	constexpr natural &add_unaliased(natural_view other) &
 	{
-		std::uintmax_t carry = 0, mul = 0, exteded_digit = digit;
+		const auto other_size = other.size();
+		digits_.resize(std::max(std::ranges::size(digits_), other_size) + 1);
 
-		for (auto &num_digit : digits_)
+		for (size_type i = 0; i < other_size; ++i)
 		{
-			mul = exteded_digit * num_digit + carry;
-			num_digit = mul % number_system_base;
-			carry = mul / number_system_base;
+			add_digit(other[i], i);
 		}
 
-		if (carry != 0)
+		erase_leading_zeroes();
+		return *this;
+	}
+
+	/**
+	 * Subtracts a number that does not view the digits of this one.
+	 *
+	 * @param other Subtrahend, not greater than this number and not a view of it
+	 *
+	 * @return Reference to the instance
+	 */
+	constexpr natural &subtract_unaliased(natural_view other) &
+	{
+		for (size_type i = 0; i < other.size(); ++i)
 		{
-			digits_.push_back(carry);
+			sub_digit(other[i], i);
 		}
 
+		erase_leading_zeroes();
 		return *this;
 	}
 
@@ -165,11 +204,11 @@ private:
 	 *
 	 * @note This member function expects `lhs` to be greated than `second` and `second` to be not zero.
 	 */
-        [[nodiscard]] constexpr natural find_quotient(const natural &lhs, const natural &second) const &
+        [[nodiscard]] static constexpr natural find_quotient(const natural &lhs, natural_view second)
 	{
 		natural quotient{};
 
-		if (std::ranges::size(second.digits_) == 1)
+		if (second.size() == 1)
 		{
 			std::uintmax_t divisible = 0;
 
@@ -179,7 +218,7 @@ private:
 				divisible += digit;
 			}
 
-			quotient = divisible / second.digits_.back();
+			quotient = divisible / second[0];
 		}
 		else
 		{
@@ -191,7 +230,7 @@ private:
 			while (low < high)
 			{
 				mid = (low + high + 1) / 2;
-				natural current = second;
+				natural current(second);
 				current = current.mul_digit(mid);
 
 				if (current > lhs)
@@ -213,32 +252,32 @@ private:
 	/**
 	 * Performs school-grade multiplication on two numbers.
 	 *
-	 * @param lhs    Left-hand side of the operation
-	 * @param second Right-hand side of the operation
+	 * @param lhs Left-hand side of the operation
+	 * @param rhs Right-hand side of the operation
 	 *
-	 * @return `lhs` div `second`
+	 * @return `lhs` mul `rhs`
 	 */
-	[[nodiscard]] constexpr natural school_grade_mul(const natural &lhs, const natural &rhs) &
+	[[nodiscard]] static constexpr natural school_grade_mul(natural_view lhs, natural_view rhs)
 	{
-		if (std::ranges::size(lhs.digits_) < std::ranges::size(rhs.digits_))
+		if (lhs.size() < rhs.size())
 		{
 			return school_grade_mul(rhs, lhs);
 		}
 
 		if (lhs.is_zero() || rhs.is_zero())
 		{
-			nullify();
-			return *this;
+			return {};
 		}
 
-		if (std::ranges::size(rhs.digits_) == 1)
+		if (rhs.size() == 1)
 		{
 			natural result(lhs);
-			return result.mul_digit(rhs.digits_.front());
+			result.mul_digit(rhs[0]);
+			return result;
 		}
 
-		const auto &this_size = std::ranges::size(lhs.digits_);
-		const auto &other_size = std::ranges::size(rhs.digits_);
+		const auto this_size = lhs.size();
+		const auto other_size = rhs.size();
 
 		natural result{};
 		result.digits_.resize(this_size + other_size);
@@ -247,8 +286,8 @@ private:
 		{
 			for (size_type j = 0; j < other_size; ++j)
 			{
-				std::uintmax_t product = lhs.digits_[i];
-				product *= rhs.digits_[j];
+				std::uintmax_t product = lhs[i];
+				product *= rhs[j];
 				product += result.digits_[i + j];
 
 				if (product >= number_system_base)
@@ -265,66 +304,94 @@ private:
 	}
 
 	/**
-	 * Splits the number into two parts.
+	 * Computes the three Karatsuba subproducts on the threads of a pool.
 	 *
-	 * @param pos Position at which to perform the split
+	 * The forked subproducts are built on the threads that compute them and
+	 * assigned on the calling thread, as `z0` and `z2` may be bound to a scoped
+	 * resource of the calling thread that other threads must not allocate from.
 	 *
-	 * @return `(low, high)` pair
+	 * @param pool  Thread pool
+	 * @param low1  Low part of the left-hand side
+	 * @param high1 High part of the left-hand side
+	 * @param low2  Low part of the right-hand side
+	 * @param high2 High part of the right-hand side
+	 * @param z0    Product of the low parts
+	 * @param z1    Product of the sums of the parts
+	 * @param z2    Product of the high parts
 	 */
-	[[nodiscard]] constexpr std::pair<natural, natural> split_at(size_type pos) const
+	static void fork_subproducts(execution::thread_pool &pool,
+		natural_view low1, natural_view high1, natural_view low2, natural_view high2,
+		natural &z0, natural &z1, natural &z2)
 	{
-		if (pos <= std::ranges::size(digits_))
-		{
-			digits_type high(std::ranges::size(digits_) - pos);
-			digits_type low(pos);
+		std::optional<natural> low;
+		std::optional<natural> high;
 
-			for (size_type i = 0; i < high.size(); ++i)
-			{
-				high[i] = digits_[i + pos];
-			}
+		execution::task_group group(pool);
+		group.run([&] { low.emplace(karatsuba_mul(low1, low2, &pool)); });
+		group.run([&] { high.emplace(karatsuba_mul(high1, high2, &pool)); });
 
-			for (size_type i = 0; i < low.size(); ++i)
-			{
-				low[i] = digits_[i];
-			}
+		natural sum1(low1);
+		natural sum2(low2);
+		sum1 += high1;
+		sum2 += high2;
 
-			return {natural(std::move(high)), natural(std::move(low))};
-		}
+		z1 = karatsuba_mul(sum1, sum2, &pool);
+		group.wait();
 
-		return {0, *this};
+		z0 = std::move(*low);
+		z2 = std::move(*high);
 	}
 
 	/**
 	 * Performs the Karatsuba quick multiplication algorithm.
 	 *
-	 * @param lhs Left-hand side of the operation
-	 * @param rhs Right-hand side of the operation
+	 * The operands are split into subviews, so only the sums of the halves are copied.
 	 *
-	 * @return `lhs` div `rhs`
+	 * @param lhs  Left-hand side of the operation
+	 * @param rhs  Right-hand side of the operation
+	 * @param pool Thread pool to run the three subproducts on while they are not
+	 *             shorter than `parallel_mul_threshold`, `nullptr` to run sequentially
+	 *
+	 * @return `lhs` mul `rhs`
 	 */
-	[[nodiscard]] constexpr natural karatsuba_mul(const natural &lhs, const natural &rhs)
+	[[nodiscard]] static constexpr natural karatsuba_mul(natural_view lhs, natural_view rhs, execution::thread_pool *pool = nullptr)
 	{
-		const auto &size1 = std::ranges::size(lhs.digits_);
-		const auto &size2 = std::ranges::size(rhs.digits_);
+		const auto size1 = lhs.size();
+		const auto size2 = rhs.size();
 
 		if (size1 < karatsuba_threshold || size2 < karatsuba_threshold)
 		{
 			return school_grade_mul(lhs, rhs);
 		}
 
-		const auto &m = std::max(size1, size2);
+		const auto m = std::max(size1, size2);
    		const auto m2 = m / 2;
 
-		auto [high1, low1] = lhs.split_at(m2);
-		auto [high2, low2] = rhs.split_at(m2);
+		const auto low1 = lhs.subview(0, m2);
+		const auto high1 = lhs.subview(m2);
+		const auto low2 = rhs.subview(0, m2);
+		const auto high2 = rhs.subview(m2);
+
+		natural z0;
+		natural z2;
+		natural z1;
 
-		const natural z0 = karatsuba_mul(low1, low2);
-		natural z2 = karatsuba_mul(high1, high2);
+		if (pool != nullptr && m2 >= parallel_mul_threshold)
+		{
+			fork_subproducts(*pool, low1, high1, low2, high2, z0, z1, z2);
+		}
+		else
+		{
+			z0 = karatsuba_mul(low1, low2);
+			z2 = karatsuba_mul(high1, high2);
 
-		low1 += high1;
-		low2 += high2;
+			natural sum1(low1);
+			natural sum2(low2);
+			sum1 += high1;
+			sum2 += high2;
 
-		natural z1 = karatsuba_mul(low1, low2);
+			z1 = karatsuba_mul(sum1, sum2);
+		}
 
 		z1 -= z2;
 		z1 -= z0;
@@ -336,6 +403,69 @@ private:
 
 		return z2;
 	}
+
+	/**
+	 * Performs the long division algorithm.
+	 *
+	 * @param dividend Dividend
+	 * @param divisor  Divisor
+	 *
+	 * @return `{quotient, remainder}` pair
+	 */
+	[[nodiscard]] static constexpr std::pair<natural, natural> divide(natural_view dividend, natural_view divisor)
+	{
+		if (divisor.is_zero())
+		{
+			throw std::domain_error("division by zero");
+		}
+
+		if (dividend < divisor)
+		{
+			return {natural{}, natural(dividend)};
+		}
+
+		natural quotient{};
+		natural remainder{};
+		natural product{};
+
+		for (const auto &digit : dividend.digits() | std::views::reverse)
+		{
+			remainder <<= 1;
+			remainder += digit;
+
+			if (remainder < divisor)
+			{
+				quotient <<= 1;
+				continue;
+			}
+
+			// finding the maximum x such that: divisor * x <= remainder
+			const auto x = find_quotient(remainder, divisor);
+
+			quotient <<= 1;
+			quotient += x;
+
+			// x is a single digit
+			product.assign(divisor);
+			product.mul_digit(x.digits_.front());
+			remainder -= product;
+		}
+
+		quotient.erase_leading_zeroes();
+		remainder.erase_leading_zeroes();
+
+		return {quotient, remainder};
+	}
+
+	/**
+	 * Replaces the digits of the number, reusing the storage.
+	 *
+	 * @param other View of the new value, must not point into the digits of the number
+	 */
+	constexpr void assign(natural_view other) &
+	{
+		digits_.assign(std::ranges::begin(other.digits()), std::ranges::end(other.digits()));
+	}
 public:
 	[[nodiscard]] constexpr natural(const digits_type &digits = {})
 	{
@@ -388,10 +518,79 @@ public:
 
 	template <std::signed_integral T>
 	[[nodiscard]] constexpr natural(T value) noexcept
-		: natural(static_cast<std::uintmax_t>(std::abs(value)))
+		: natural(value < 0 ? 0 - static_cast<std::uintmax_t>(value) : static_cast<std::uintmax_t>(value))
 	{}
 
-	[[nodiscard]] natural(std::string_view num);
+	/**
+	 * Constructs the number from a view, copying the viewed digits.
+	 *
+	 * @param view View of the value
+	 */
+	[[nodiscard]] constexpr explicit natural(natural_view view)
+		: digits_(std::ranges::begin(view.digits()), std::ranges::end(view.digits()))
+	{
+	}
+
+	/**
+	 * Constructs the number from its decimal digits.
+	 *
+	 * @param num Decimal digits, the most significant one first
+	 *
+	 * @throws `std::invalid_argument` if `num` is empty or contains a character that is not a decimal digit
+	 */
+	[[nodiscard]] constexpr natural(std::string_view num)
+	{
+		if (std::ranges::empty(num))
+		{
+			throw std::invalid_argument("cannot build num from empty string");
+		}
+
+		if (!pack_decimal(num, digits_))
+		{
+			throw std::invalid_argument("invalid number, one or more characters are not a digit");
+		}
+
+		erase_leading_zeroes();
+	}
+
+	/**
+	 * Packs decimal digits into limbs, starting from the least significant ones.
+	 *
+	 * Every limb is read from its own group of nine characters, so the digits
+	 * are converted in a single pass, in constant evaluation as well.
+	 *
+	 * @param digits Decimal digits, the most significant one first
+	 * @param limbs  Buffer that receives the limbs, possibly with leading zeroes
+	 *
+	 * @return `false` if `digits` is empty or contains a character that is not a decimal digit
+	 */
+	[[nodiscard]] static constexpr bool pack_decimal(std::string_view digits, digits_type &limbs)
+	{
+		limbs.clear();
+		limbs.reserve((std::ranges::size(digits) + bits_per_num - 1) / bits_per_num);
+
+		for (auto end = std::ranges::size(digits); end > 0;)
+		{
+			const auto begin = end > bits_per_num ? end - bits_per_num : 0;
+
+			digit_type limb = 0;
+			for (auto i = begin; i < end; ++i)
+			{
+				const auto ch = digits[i];
+				if (ch < '0' || ch > '9')
+				{
+					return false;
+				}
+
+				limb = limb * 10 + static_cast<digit_type>(ch - '0');
+			}
+
+			limbs.push_back(limb);
+			end = begin;
+		}
+
+		return !std::ranges::empty(limbs);
+	}
 
 
 	/**
@@ -416,6 +615,31 @@ public:
 		return digits_.size() == 1 && digits_.front() == 0;
 	}
 
+	/**
+	 * Gets the digits of the number.
+	 *
+	 * @return Digits in the number system, starting from the least significant one
+	 */
+	[[nodiscard]] constexpr const digits_type &digits() const & noexcept
+	{
+		return digits_;
+	}
+
+	/**
+	 * Gets the view of the number.
+	 *
+	 * @return View of the digits, invalidated by any modification of the number
+	 */
+	[[nodiscard]] constexpr natural_view view() const & noexcept
+	{
+		return natural_view::unchecked(digits_);
+	}
+
+	[[nodiscard]] constexpr operator natural_view() const & noexcept
+	{
+		return view();
+	}
+
 	/**
 	 * Performs the long division algorithm.
 	 *
@@ -423,68 +647,241 @@ public:
 	 *
 	 * @return `{quotient, remainder}` pair
 	 */
-	[[nodiscard]] constexpr std::pair<natural, natural> long_div(const natural &divisor) const
+	[[nodiscard]] constexpr std::pair<natural, natural> long_div(natural_view divisor) const
 	{
-		if (divisor.is_zero())
+		return divide(view(), divisor);
+	}
+
+	/**
+	 * Performs the long division algorithm under the given execution policy.
+	 *
+	 * @param divisor Divisor
+	 *
+	 * @return `{quotient, remainder}` pair
+	 *
+	 * @note Every quotient digit depends on the remainder left by the previous one, and a digit is
+	 *       found by a few dozen single-digit multiplications, which are too short to be shared
+	 *       between threads, so the division runs on the calling thread under any policy.
+	 */
+	[[nodiscard]] std::pair<natural, natural> long_div(natural_view divisor, const execution::policy &) const
+	{
+		return divide(view(), divisor);
+	}
+
+	/**
+	 * Multiplies a number by a single digit.
+	 *
+	 * @param digit Digit value
+	 *
+	 * @return Reference to the instance
+	 *
+	 * @note MUL_ND_N
+	 */
+	constexpr natural &mul_digit(const digit_type digit) &
+	{
+		if (digit == 0)
 		{
-			throw std::domain_error("division by zero");
+			nullify();
+			return *this;
 		}
 
-		if (*this < divisor)
+		std::uintmax_t carry = 0, mul = 0, exteded_digit = digit;
+
+		for (auto &num_digit : digits_)
 		{
-			return {0, *this};
+			mul = exteded_digit * num_digit + carry;
+			num_digit = mul % number_system_base;
+			carry = mul / number_system_base;
 		}
 
-		natural quotient{};
-		natural remainder{};
+		if (carry != 0)
+		{
+			digits_.push_back(carry);
+		}
 
-		for (const auto &digit : digits_ | std::views::reverse)
+		return *this;
+	}
+
+	/**
+	 * Divides the number by a single digit.
+	 *
+	 * @param digit Digit value
+	 *
+	 * @return Remainder of the division
+	 *
+	 * @throws `std::domain_error` if `digit` is zero
+	 */
+	constexpr digit_type div_digit(const digit_type digit) &
+	{
+		if (digit == 0)
 		{
-			remainder <<= 1;
-			remainder += digit;
+			throw std::domain_error("division by zero");
+		}
 
-			if (remainder < divisor)
-			{
-				quotient <<= 1;
-				continue;
-			}
+		std::uintmax_t remainder = 0;
 
-			// finding the maximum x such that: divisor * x <= remainder
-			const auto x = find_quotient(remainder, divisor);
+		for (auto &num_digit : digits_ | std::views::reverse)
+		{
+			const auto current = remainder * number_system_base + num_digit;
+			num_digit = current / digit;
+			remainder = current % digit;
+		}
 
-			quotient <<= 1;
-			quotient += x;
+		erase_leading_zeroes();
+		return remainder;
+	}
+
+	/**
+	 * Finds the multiplicative inverse of a digit modulo the number system base.
+	 *
+	 * @param digit Digit value
+	 *
+	 * @return `x` such that `digit * x` is `1` modulo the number system base
+	 *
+	 * @note This member function expects `digit` to be coprime with the number system base.
+	 */
+	[[nodiscard]] static constexpr std::uintmax_t inverse_digit(const digit_type digit) noexcept
+	{
+		std::intmax_t r0 = number_system_base, r1 = digit;
+		std::intmax_t t0 = 0, t1 = 1;
 
-			remainder -= x * divisor;
+		while (r1 != 0)
+		{
+			const auto q = r0 / r1;
+			r0 = std::exchange(r1, r0 - q * r1);
+			t0 = std::exchange(t1, t0 - q * t1);
 		}
 
-		quotient.erase_leading_zeroes();
-		remainder.erase_leading_zeroes();
+		return t0 < 0 ? t0 + number_system_base : t0;
+	}
 
-		return {quotient, remainder};
+	/**
+	 * Finds the remainder of the division of the number by a single digit.
+	 *
+	 * @param digit Digit value
+	 *
+	 * @return Remainder of the division
+	 *
+	 * @throws `std::domain_error` if `digit` is zero
+	 */
+	[[nodiscard]] constexpr digit_type mod_digit(const digit_type digit) const
+	{
+		if (digit == 0)
+		{
+			throw std::domain_error("division by zero");
+		}
+
+		std::uintmax_t remainder = 0;
+
+		for (const auto &num_digit : digits_ | std::views::reverse)
+		{
+			remainder = (remainder * number_system_base + num_digit) % digit;
+		}
+
+		return remainder;
 	}
 
-	[[nodiscard]] constexpr std::strong_ordering operator<=>(const natural &other) const noexcept
+	/**
+	 * Performs the exact division, i.e. the division that is known to leave no remainder.
+	 *
+	 * Trailing zero digits and the factors of the number system base that the divisor
+	 * has in its lowest digit are divided out of both operands first. The quotient is
+	 * then found from the least significant digit upwards (Hensel division), without
+	 * trial quotients and without computing the high half of the remainder.
+	 *
+	 * @param divisor Divisor
+	 *
+	 * @return `*this` div `divisor`
+	 *
+	 * @throws `std::domain_error` if `divisor` is zero
+	 *
+	 * @note The result is unspecified if `divisor` does not divide the number.
+	 */
+	[[nodiscard]] constexpr natural divexact(const natural &divisor) const
 	{
-		const auto this_size = std::ranges::size(digits_);
-		const auto other_size = std::ranges::size(other.digits_);
+		if (divisor.is_zero())
+		{
+			throw std::domain_error("division by zero");
+		}
 
-		if (!this_size || !other_size || this_size != other_size)
+		if (*this < divisor)
 		{
-			return this_size <=> other_size;
+			return {};
 		}
 
-		const auto &order = this_size - 1;
+		size_type zeroes = 0;
+		while (divisor.digits_[zeroes] == 0)
+		{
+			++zeroes;
+		}
+
+		natural dividend = *this >> zeroes;
+		natural exact_divisor = divisor >> zeroes;
 
-		for (size_type i = 0; i <= order; ++i)
+		// the lowest digit only determines divisibility by up to the 9th power of 2 and 5
+		for (const digit_type factor : {2u, 5u})
 		{
-			if (digits_[order - i] != other.digits_[order - i])
+			while (exact_divisor.digits_.front() % factor == 0)
 			{
-				return digits_[order - i] <=> other.digits_[order - i];
+				digit_type power = 1;
+				auto low = exact_divisor.digits_.front();
+				for (std::uint8_t i = 0; i < bits_per_num && low % factor == 0; ++i, low /= factor)
+				{
+					power *= factor;
+				}
+
+				dividend.div_digit(power);
+				exact_divisor.div_digit(power);
 			}
 		}
 
-		return std::strong_ordering::equal;
+		if (std::ranges::size(exact_divisor.digits_) == 1)
+		{
+			dividend.div_digit(exact_divisor.digits_.front());
+			return dividend;
+		}
+
+		const auto &divisor_digits = exact_divisor.digits_;
+		const auto divisor_size = std::ranges::size(divisor_digits);
+		const auto inverse = inverse_digit(divisor_digits.front());
+
+		auto &remainder = dividend.digits_;
+		const auto quotient_size = std::ranges::size(remainder) - divisor_size + 1;
+
+		digits_type quotient(quotient_size);
+
+		for (size_type i = 0; i < quotient_size; ++i)
+		{
+			const std::uintmax_t digit = remainder[i] * inverse % number_system_base;
+			quotient[i] = digit;
+
+			// only the digits below `quotient_size` are ever read again
+			std::uintmax_t carry = 0;
+			std::uintmax_t borrow = 0;
+			for (size_type j = 0; i + j < quotient_size && (j < divisor_size || carry != 0 || borrow != 0); ++j)
+			{
+				std::uintmax_t subtrahend = carry + borrow;
+				carry = 0;
+
+				if (j < divisor_size)
+				{
+					const auto product = digit * divisor_digits[j] + subtrahend;
+					carry = product / number_system_base;
+					subtrahend = product % number_system_base;
+				}
+
+				auto &current = remainder[i + j];
+				borrow = current < subtrahend;
+				current = current + borrow * number_system_base - subtrahend;
+			}
+		}
+
+		return natural(std::move(quotient));
+	}
+
+	[[nodiscard]] constexpr std::strong_ordering operator<=>(const natural &other) const noexcept
+	{
+		return view() <=> other.view();
 	}
 
 	[[nodiscard]] constexpr bool operator==(const natural &other) const noexcept
@@ -530,21 +927,23 @@ public:
 			return *this *= 2;
 		}
 
+		return *this += other.view();
+	}
+
+	constexpr natural &operator+=(natural_view other) &
+	{
 		if (other.is_zero())
 		{
 			return *this;
 		}
 
-		const auto other_size = std::ranges::size(other.digits_);
-		digits_.resize(std::max(std::ranges::size(digits_), other_size) + 1);
-
-		for (size_type i = 0; i < other_size; ++i)
+		if (overlaps(other))
 		{
-			add_digit(other.digits_[i], i);
+			const natural copy(other);
+			return add_unaliased(copy.view());
 		}
 
-		erase_leading_zeroes();
-		return *this;
+		return add_unaliased(other);
 	}
 
 	/**
@@ -552,29 +951,34 @@ public:
 	 */
 	constexpr natural &operator-=(const natural &other) &
 	{
-		if (other > *this)
-		{
-			throw std::domain_error("it is impossible to subtract a larger natural number");
-		}
-
 		if (this == &other)
 		{
 			nullify();
 			return *this;
 		}
 
+		return *this -= other.view();
+	}
+
+	constexpr natural &operator-=(natural_view other) &
+	{
+		if (other > view())
+		{
+			throw std::domain_error("it is impossible to subtract a larger natural number");
+		}
+
 		if (other.is_zero())
 		{
 			return *this;
 		}
 
-		for (size_type i = 0; i < std::ranges::size(other.digits_); ++i)
+		if (overlaps(other))
 		{
-			sub_digit(other.digits_[i], i);
+			const natural copy(other);
+			return subtract_unaliased(copy.view());
 		}
 
-		erase_leading_zeroes();
-		return *this;
+		return subtract_unaliased(other);
 	}
 
 	/**
@@ -582,7 +986,40 @@ public:
 	 */
 	constexpr natural &operator*=(const natural &other) &
 	{
-		*this = karatsuba_mul(*this, other);
+		return *this *= other.view();
+	}
+
+	constexpr natural &operator*=(natural_view other) &
+	{
+		if (!std::is_constant_evaluated()
+			&& std::min(std::ranges::size(digits_), other.size()) >= 2 * parallel_mul_threshold)
+		{
+			return multiply(other, execution::default_policy());
+		}
+
+		*this = karatsuba_mul(view(), other);
+		return *this;
+	}
+
+	/**
+	 * Multiplies the number under the given execution policy.
+	 *
+	 * @param other  Multiplier
+	 * @param policy Execution policy, the top levels of the Karatsuba recursion
+	 *               are forked onto its pool for operands of at least
+	 *               `2 * parallel_mul_threshold` digits
+	 *
+	 * @return Reference to the instance
+	 */
+	natural &multiply(natural_view other, const execution::policy &policy) &
+	{
+		std::shared_ptr<execution::thread_pool> pool;
+		if (std::min(std::ranges::size(digits_), other.size()) >= 2 * parallel_mul_threshold)
+		{
+			pool = policy.pool();
+		}
+
+		*this = karatsuba_mul(view(), other, pool.get());
 		return *this;
 	}
 
@@ -590,6 +1027,11 @@ public:
 	 * @note DIV_NN_N
 	 */
 	constexpr natural &operator/=(const natural &other) &
+	{
+		return *this /= other.view();
+	}
+
+	constexpr natural &operator/=(natural_view other) &
 	{
 		digits_ = long_div(other).first.digits_;
 		return *this;
@@ -599,6 +1041,11 @@ public:
 	 * @note MOD_NN_N
 	 */
 	constexpr natural &operator%=(const natural &other) &
+	{
+		return *this %= other.view();
+	}
+
+	constexpr natural &operator%=(natural_view other) &
 	{
 		digits_ = long_div(other).second.digits_;
 		return *this;
@@ -688,12 +1135,19 @@ public:
 
 	friend std::ostream &operator<<(std::ostream &out, const natural &num);
 
+	/**
+	 * Reads a decimal number, packing the digits into limbs as they are read.
+	 *
+	 * @note Sets `failbit` and leaves `num` unchanged if the stream does not continue with a digit.
+	 */
+	friend std::istream &operator>>(std::istream &in, natural &num);
+
 	template <std::integral T>
 	[[nodiscard]] explicit operator T() const & noexcept
 	{
 		T val{};
 
-		for (const auto &digit : digits_)
+		for (const auto &digit : digits_ | std::views::reverse)
 		{
 			val = val * number_system_base + static_cast<T>(digit);
 		}
@@ -701,4 +1155,47 @@ public:
 		return val;
 	}
 };
+
+static_assert(std::same_as<natural::digit_type, natural_view::digit_type>);
+static_assert(natural::number_system_base == natural_view::number_system_base);
+
+[[nodiscard]] constexpr natural operator+(natural_view lhs, natural_view rhs)
+{
+	natural tmp(lhs);
+	tmp += rhs;
+	return tmp;
+}
+
+[[nodiscard]] constexpr natural operator-(natural_view lhs, natural_view rhs)
+{
+	natural tmp(lhs);
+	tmp -= rhs;
+	return tmp;
+}
+
+[[nodiscard]] constexpr natural operator*(natural_view lhs, natural_view rhs)
+{
+	natural tmp(lhs);
+	tmp *= rhs;
+	return tmp;
+}
+
+[[nodiscard]] constexpr natural operator/(natural_view lhs, natural_view rhs)
+{
+	return natural(lhs).long_div(rhs).first;
+}
+
+[[nodiscard]] constexpr natural operator%(natural_view lhs, natural_view rhs)
+{
+	return natural(lhs).long_div(rhs).second;
+}
 }
+
+template <>
+struct std::hash<big::natural>
+{
+	[[nodiscard]] constexpr std::size_t operator()(const big::natural &value) const noexcept
+	{
+		return std::hash<big::natural_view>{}(value);
+	}
+};
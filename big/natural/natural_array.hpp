@@ -0,0 +1,520 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "natural.hpp"
+#include "../algorithm/sort.hpp"
+
+
+namespace big
+{
+/**
+ * Sequence of natural numbers stored in a single contiguous limb buffer.
+ *
+ * The limbs of all elements are stored back to back, and the elements are
+ * delimited by an array of offsets, so an element costs eight bytes on top of
+ * its limbs and the whole sequence takes two allocations. Elements are accessed
+ * as views, which are invalidated by any modification of the array.
+ */
+class natural_array
+{
+public:
+	using digit_type = natural::digit_type;
+	using size_type = std::size_t;
+	using value_type = natural_view;
+
+	/**
+	 * Random access iterator over the elements, yields views.
+	 */
+	class iterator
+	{
+		const natural_array *array_ = nullptr;
+		size_type index_ = 0;
+	public:
+		using iterator_concept = std::random_access_iterator_tag;
+		using value_type = natural_view;
+		using difference_type = std::ptrdiff_t;
+
+		[[nodiscard]] iterator() noexcept = default;
+
+		[[nodiscard]] iterator(const natural_array *array, size_type index) noexcept : array_(array), index_(index)
+		{
+		}
+
+		[[nodiscard]] natural_view operator*() const noexcept
+		{
+			return (*array_)[index_];
+		}
+
+		[[nodiscard]] natural_view operator[](difference_type n) const noexcept
+		{
+			return (*array_)[index_ + n];
+		}
+
+		iterator &operator++() noexcept
+		{
+			++index_;
+			return *this;
+		}
+
+		iterator operator++(int) noexcept
+		{
+			return {array_, index_++};
+		}
+
+		iterator &operator--() noexcept
+		{
+			--index_;
+			return *this;
+		}
+
+		iterator operator--(int) noexcept
+		{
+			return {array_, index_--};
+		}
+
+		iterator &operator+=(difference_type n) noexcept
+		{
+			index_ += n;
+			return *this;
+		}
+
+		iterator &operator-=(difference_type n) noexcept
+		{
+			index_ -= n;
+			return *this;
+		}
+
+		[[nodiscard]] friend iterator operator+(iterator it, difference_type n) noexcept
+		{
+			return it += n;
+		}
+
+		[[nodiscard]] friend iterator operator+(difference_type n, iterator it) noexcept
+		{
+			return it += n;
+		}
+
+		[[nodiscard]] friend iterator operator-(iterator it, difference_type n) noexcept
+		{
+			return it -= n;
+		}
+
+		[[nodiscard]] friend difference_type operator-(const iterator &lhs, const iterator &rhs) noexcept
+		{
+			return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+		}
+
+		[[nodiscard]] friend bool operator==(const iterator &lhs, const iterator &rhs) noexcept
+		{
+			return lhs.index_ == rhs.index_;
+		}
+
+		[[nodiscard]] friend std::strong_ordering operator<=>(const iterator &lhs, const iterator &rhs) noexcept
+		{
+			return lhs.index_ <=> rhs.index_;
+		}
+	};
+
+	using const_iterator = iterator;
+private:
+	natural::digits_type limbs_;
+	std::vector<std::uint64_t> offsets_{0};
+
+	/**
+	 * Registers the limbs appended after the last element as a new element.
+	 *
+	 * @note Leading zeroes are erased, keeping a single limb for zero.
+	 */
+	void seal()
+	{
+		const auto begin = offsets_.back();
+		while (std::ranges::size(limbs_) > begin + 1 && limbs_.back() == 0)
+		{
+			limbs_.pop_back();
+		}
+
+		if (std::ranges::size(limbs_) == begin)
+		{
+			limbs_.push_back(0);
+		}
+
+		offsets_.push_back(std::ranges::size(limbs_));
+	}
+
+	/**
+	 * Appends zeroed limbs for a new element.
+	 *
+	 * @param count Number of limbs
+	 *
+	 * @return Pointer to the first appended limb
+	 */
+	[[nodiscard]] digit_type *grow(size_type count)
+	{
+		const auto size = std::ranges::size(limbs_);
+		limbs_.resize(size + count);
+		return std::ranges::data(limbs_) + size;
+	}
+
+	template <typename F>
+	[[nodiscard]] static natural_array transform(const natural_array &lhs, const natural_array &rhs, const F &f)
+	{
+		if (lhs.size() != rhs.size())
+		{
+			throw std::invalid_argument("arrays of " + std::to_string(lhs.size()) + " and "
+				+ std::to_string(rhs.size()) + " elements cannot be combined");
+		}
+
+		natural_array result;
+		result.offsets_.reserve(lhs.size() + 1);
+
+		for (size_type i = 0; i < lhs.size(); ++i)
+		{
+			f(result, lhs[i], rhs[i]);
+		}
+
+		return result;
+	}
+public:
+	[[nodiscard]] natural_array() = default;
+
+	/**
+	 * Constructs the array from a range of numbers.
+	 *
+	 * @tparam R Range type
+	 *
+	 * @param values Numbers
+	 */
+	template <std::ranges::input_range R>
+		requires std::convertible_to<std::ranges::range_reference_t<R>, natural_view>
+	[[nodiscard]] explicit natural_array(R &&values)
+	{
+		if constexpr (std::ranges::forward_range<R>)
+		{
+			size_type limbs = 0;
+			size_type count = 0;
+			for (const natural_view value : values)
+			{
+				limbs += value.size();
+				++count;
+			}
+
+			reserve(count, limbs);
+		}
+
+		for (const natural_view value : values)
+		{
+			push_back(value);
+		}
+	}
+
+	[[nodiscard]] size_type size() const noexcept
+	{
+		return std::ranges::size(offsets_) - 1;
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	/**
+	 * Gets the total number of limbs of the elements.
+	 *
+	 * @return Number of limbs
+	 */
+	[[nodiscard]] size_type limb_count() const noexcept
+	{
+		return std::ranges::size(limbs_);
+	}
+
+	/**
+	 * Reserves storage.
+	 *
+	 * @param elements Number of elements
+	 * @param limbs    Total number of limbs of the elements
+	 */
+	void reserve(size_type elements, size_type limbs)
+	{
+		offsets_.reserve(elements + 1);
+		limbs_.reserve(limbs);
+	}
+
+	void clear() noexcept
+	{
+		limbs_.clear();
+		offsets_.resize(1);
+	}
+
+	[[nodiscard]] natural_view operator[](size_type index) const noexcept
+	{
+		const auto begin = static_cast<size_type>(offsets_[index]);
+		const auto end = static_cast<size_type>(offsets_[index + 1]);
+		return natural_view::unchecked(std::span(limbs_).subspan(begin, end - begin));
+	}
+
+	/**
+	 * Gets an element with bounds checking.
+	 *
+	 * @param index Index of the element
+	 *
+	 * @return View of the element
+	 *
+	 * @throws `std::out_of_range` if `index` is out of range
+	 */
+	[[nodiscard]] natural_view at(size_type index) const
+	{
+		if (index >= size())
+		{
+			throw std::out_of_range(std::to_string(index) + " is out of range");
+		}
+
+		return (*this)[index];
+	}
+
+	[[nodiscard]] natural_view front() const noexcept
+	{
+		return (*this)[0];
+	}
+
+	[[nodiscard]] natural_view back() const noexcept
+	{
+		return (*this)[size() - 1];
+	}
+
+	[[nodiscard]] iterator begin() const noexcept
+	{
+		return {this, 0};
+	}
+
+	[[nodiscard]] iterator end() const noexcept
+	{
+		return {this, size()};
+	}
+
+	/**
+	 * Appends a number.
+	 *
+	 * @param value Number, may be a view of an element of the array
+	 */
+	void push_back(natural_view value)
+	{
+		const auto digits = value.digits();
+		const auto *data = std::ranges::data(digits);
+		const auto *limbs = std::ranges::data(limbs_);
+
+		// growing the buffer would invalidate a view of an element
+		const bool aliases = !std::less{}(data, limbs) && std::less{}(data, limbs + std::ranges::size(limbs_));
+		const auto offset = aliases ? data - limbs : 0;
+
+		auto *target = grow(std::ranges::size(digits));
+		const auto source = aliases ? std::span<const digit_type>(std::ranges::data(limbs_) + offset, std::ranges::size(digits)) : digits;
+		std::ranges::copy(source, target);
+
+		offsets_.push_back(std::ranges::size(limbs_));
+	}
+
+	/**
+	 * Appends the elements of an array.
+	 *
+	 * @param other Array, may be this array
+	 */
+	void append(const natural_array &other)
+	{
+		if (this == &other)
+		{
+			append(natural_array(other));
+			return;
+		}
+
+		const auto base = offsets_.back();
+		limbs_.insert(std::ranges::end(limbs_), std::ranges::begin(other.limbs_), std::ranges::end(other.limbs_));
+
+		offsets_.reserve(std::ranges::size(offsets_) + other.size());
+		for (auto it = std::ranges::next(std::ranges::begin(other.offsets_)); it != std::ranges::end(other.offsets_); ++it)
+		{
+			offsets_.push_back(base + *it);
+		}
+	}
+
+	void pop_back() noexcept
+	{
+		offsets_.pop_back();
+		limbs_.resize(offsets_.back());
+	}
+
+	/**
+	 * Sorts the elements in ascending order.
+	 *
+	 * The indices of the elements are sorted by `algorithm::sort_permutation`,
+	 * and the limbs are then moved to their places in a single pass.
+	 */
+	void sort()
+	{
+		const auto order = algorithm::sort_permutation(*this);
+
+		natural_array sorted;
+		sorted.reserve(size(), limb_count());
+
+		for (const auto index : order)
+		{
+			sorted.push_back((*this)[index]);
+		}
+
+		*this = std::move(sorted);
+	}
+
+	/**
+	 * Adds the elements of two arrays pairwise.
+	 *
+	 * @param lhs Left-hand sides
+	 * @param rhs Right-hand sides, as many as `lhs`
+	 *
+	 * @return Array of the sums
+	 *
+	 * @throws `std::invalid_argument` if the arrays have different sizes
+	 */
+	[[nodiscard]] friend natural_array batch_add(const natural_array &lhs, const natural_array &rhs)
+	{
+		return transform(lhs, rhs, [](natural_array &result, natural_view a, natural_view b)
+		{
+			if (a.size() < b.size())
+			{
+				std::swap(a, b);
+			}
+
+			auto *out = result.grow(a.size() + 1);
+
+			digit_type carry = 0;
+			for (size_type i = 0; i < a.size(); ++i)
+			{
+				const auto sum = a[i] + (i < b.size() ? b[i] : 0) + carry;
+				carry = sum >= natural::number_system_base;
+				out[i] = carry ? sum - natural::number_system_base : sum;
+			}
+
+			out[a.size()] = carry;
+			result.seal();
+		});
+	}
+
+	/**
+	 * Subtracts the elements of two arrays pairwise.
+	 *
+	 * @param lhs Minuends
+	 * @param rhs Subtrahends, as many as `lhs`
+	 *
+	 * @return Array of the differences
+	 *
+	 * @throws `std::invalid_argument` if the arrays have different sizes
+	 * @throws `std::domain_error` if a subtrahend is larger than its minuend
+	 */
+	[[nodiscard]] friend natural_array batch_sub(const natural_array &lhs, const natural_array &rhs)
+	{
+		return transform(lhs, rhs, [](natural_array &result, natural_view a, natural_view b)
+		{
+			if (b > a)
+			{
+				throw std::domain_error("it is impossible to subtract a larger natural number");
+			}
+
+			auto *out = result.grow(a.size());
+
+			digit_type borrow = 0;
+			for (size_type i = 0; i < a.size(); ++i)
+			{
+				const auto subtrahend = (i < b.size() ? b[i] : 0) + borrow;
+				borrow = a[i] < subtrahend;
+				out[i] = a[i] + (borrow ? natural::number_system_base : 0) - subtrahend;
+			}
+
+			result.seal();
+		});
+	}
+
+	/**
+	 * Multiplies the elements of two arrays pairwise.
+	 *
+	 * @param lhs Left-hand sides
+	 * @param rhs Right-hand sides, as many as `lhs`
+	 *
+	 * @return Array of the products
+	 *
+	 * @throws `std::invalid_argument` if the arrays have different sizes
+	 *
+	 * @note Products of operands below `natural::karatsuba_threshold` limbs are
+	 *       accumulated in the buffer of the result, without temporaries.
+	 */
+	[[nodiscard]] friend natural_array batch_mul(const natural_array &lhs, const natural_array &rhs)
+	{
+		return transform(lhs, rhs, [](natural_array &result, natural_view a, natural_view b)
+		{
+			if (a.size() >= natural::karatsuba_threshold && b.size() >= natural::karatsuba_threshold)
+			{
+				result.push_back(a * b);
+				return;
+			}
+
+			auto *out = result.grow(a.size() + b.size());
+
+			for (size_type i = 0; i < a.size(); ++i)
+			{
+				std::uint64_t carry = 0;
+				for (size_type j = 0; j < b.size(); ++j)
+				{
+					const auto product = std::uint64_t{a[i]} * b[j] + out[i + j] + carry;
+					out[i + j] = static_cast<digit_type>(product % natural::number_system_base);
+					carry = product / natural::number_system_base;
+				}
+
+				out[i + b.size()] = static_cast<digit_type>(carry);
+			}
+
+			result.seal();
+		});
+	}
+
+	/**
+	 * Finds the remainders of the elements of two arrays pairwise.
+	 *
+	 * @param lhs Dividends
+	 * @param rhs Divisors, as many as `lhs`
+	 *
+	 * @return Array of the remainders
+	 *
+	 * @throws `std::invalid_argument` if the arrays have different sizes
+	 * @throws `std::domain_error` if a divisor is zero
+	 */
+	[[nodiscard]] friend natural_array batch_mod(const natural_array &lhs, const natural_array &rhs)
+	{
+		return transform(lhs, rhs, [](natural_array &result, natural_view a, natural_view b)
+		{
+			if (b.size() == 1)
+			{
+				if (b.is_zero())
+				{
+					throw std::domain_error("division by zero");
+				}
+
+				std::uint64_t remainder = 0;
+				for (size_type i = a.size(); i-- > 0;)
+				{
+					remainder = (remainder * natural::number_system_base + a[i]) % b[0];
+				}
+
+				*result.grow(1) = static_cast<digit_type>(remainder);
+				result.seal();
+				return;
+			}
+
+			result.push_back(a < b ? natural(a) : a % b);
+		});
+	}
+};
+}
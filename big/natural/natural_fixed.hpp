@@ -0,0 +1,541 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <utility>
+#include "../conv/stringifiable.hpp"
+#include "natural_view.hpp"
+
+
+namespace big
+{
+/**
+ * Finds the number of limbs a fixed-width natural number needs to hold any number of the given bit width.
+ *
+ * @param bits Bit width
+ *
+ * @return Number of limbs
+ */
+[[nodiscard]] constexpr std::size_t fixed_limbs(std::size_t bits) noexcept
+{
+	// log10(2) is below 0.30103, which bounds the number of decimal digits from above
+	const auto digits = bits * 30103 / 100000 + 1;
+	return (digits + 8) / 9;
+}
+
+/**
+ * Natural number of a fixed capacity, the limbs of which are stored inline.
+ *
+ * The limbs are in the number system of `natural` and are always all stored,
+ * so the kernels run over a number of limbs known at compile time, without
+ * allocations, normalization or exceptions. The arithmetic is modulo
+ * `number_system_base` to the power of `N`, like the arithmetic of unsigned
+ * built-in types: results that do not fit are truncated, and subtracting a
+ * larger number wraps around.
+ *
+ * @tparam N Number of limbs, see `fixed_limbs`
+ */
+template <std::size_t N>
+	requires (N > 0)
+class natural_fixed : public conv::stringifiable<natural_fixed<N>>
+{
+public:
+	using digit_type = natural_view::digit_type;
+	using size_type = std::size_t;
+
+	static constexpr digit_type number_system_base = natural_view::number_system_base;
+	static constexpr size_type limbs = N;
+private:
+	using wide_type = std::uint64_t;
+
+	std::array<digit_type, N> digits_{};
+
+	/**
+	 * Gets the number of significant limbs.
+	 *
+	 * @return Number of limbs up to the most significant nonzero one, one for zero
+	 */
+	[[nodiscard]] constexpr size_type used() const noexcept
+	{
+		size_type size = N;
+		while (size > 1 && digits_[size - 1] == 0)
+		{
+			--size;
+		}
+
+		return size;
+	}
+
+	/**
+	 * Divides one number by another with the algorithm D of Knuth.
+	 *
+	 * The operands are scaled so that the top limb of the divisor is at least
+	 * half the base, then every limb of the quotient is estimated from the top
+	 * two limbs of the partial remainder and is at most one too large.
+	 *
+	 * @param dividend Dividend
+	 * @param divisor  Divisor, not zero
+	 *
+	 * @return Quotient and remainder
+	 */
+	[[nodiscard]] static constexpr std::pair<natural_fixed, natural_fixed> divide(const natural_fixed &dividend, const natural_fixed &divisor) noexcept
+	{
+		constexpr wide_type base = number_system_base;
+
+		const auto n = divisor.used();
+		const auto size = dividend.used();
+
+		if (dividend < divisor)
+		{
+			return {natural_fixed{}, dividend};
+		}
+
+		if (n == 1)
+		{
+			natural_fixed quotient(dividend);
+			const auto remainder = quotient.div_digit(divisor.digits_[0]);
+			return {quotient, natural_fixed(remainder)};
+		}
+
+		const wide_type scale = base / (wide_type{divisor.digits_[n - 1]} + 1);
+
+		std::array<digit_type, N + 1> u{};
+		std::array<digit_type, N> v{};
+
+		wide_type carry = 0;
+		for (size_type i = 0; i < size; ++i)
+		{
+			const auto product = dividend.digits_[i] * scale + carry;
+			u[i] = static_cast<digit_type>(product % base);
+			carry = product / base;
+		}
+		u[size] = static_cast<digit_type>(carry);
+
+		carry = 0;
+		for (size_type i = 0; i < n; ++i)
+		{
+			const auto product = divisor.digits_[i] * scale + carry;
+			v[i] = static_cast<digit_type>(product % base);
+			carry = product / base;
+		}
+
+		natural_fixed quotient;
+		for (auto j = size - n + 1; j-- > 0;)
+		{
+			const auto top = wide_type{u[j + n]} * base + u[j + n - 1];
+			auto estimate = top / v[n - 1];
+			auto rest = top % v[n - 1];
+
+			while (estimate >= base || estimate * v[n - 2] > rest * base + u[j + n - 2])
+			{
+				--estimate;
+				rest += v[n - 1];
+				if (rest >= base)
+				{
+					break;
+				}
+			}
+
+			std::int64_t borrow = 0;
+			carry = 0;
+			for (size_type i = 0; i < n; ++i)
+			{
+				const auto product = estimate * v[i] + carry;
+				carry = product / base;
+
+				auto difference = std::int64_t{u[i + j]} - borrow - static_cast<std::int64_t>(product % base);
+				borrow = difference < 0;
+				if (borrow)
+				{
+					difference += number_system_base;
+				}
+
+				u[i + j] = static_cast<digit_type>(difference);
+			}
+
+			// the estimate was one too large, the divisor is added back
+			if (std::int64_t{u[j + n]} - borrow - static_cast<std::int64_t>(carry) < 0)
+			{
+				--estimate;
+
+				digit_type add_carry = 0;
+				for (size_type i = 0; i < n; ++i)
+				{
+					const digit_type sum = u[i + j] + v[i] + add_carry;
+					add_carry = sum >= base;
+					u[i + j] = sum - (add_carry ? number_system_base : 0);
+				}
+			}
+
+			// the partial remainder is below the divisor now, so its top limb is zero
+			u[j + n] = 0;
+			quotient.digits_[j] = static_cast<digit_type>(estimate);
+		}
+
+		natural_fixed remainder;
+		wide_type rest = 0;
+		for (size_type i = n; i-- > 0;)
+		{
+			const auto current = rest * base + u[i];
+			remainder.digits_[i] = static_cast<digit_type>(current / scale);
+			rest = current % scale;
+		}
+
+		return {quotient, remainder};
+	}
+public:
+	/**
+	 * Constructs zero.
+	 */
+	[[nodiscard]] constexpr natural_fixed() noexcept = default;
+
+	template <std::unsigned_integral T = std::uintmax_t>
+	[[nodiscard]] constexpr natural_fixed(T value) noexcept
+	{
+		for (size_type i = 0; i < N && value != 0; ++i)
+		{
+			digits_[i] = static_cast<digit_type>(value % number_system_base);
+			value /= number_system_base;
+		}
+	}
+
+	template <std::signed_integral T>
+	[[nodiscard]] constexpr natural_fixed(T value) noexcept
+		: natural_fixed(value < 0 ? 0 - static_cast<std::uintmax_t>(value) : static_cast<std::uintmax_t>(value))
+	{
+	}
+
+	/**
+	 * Constructs the number from a view, keeping the `N` least significant limbs.
+	 *
+	 * @param value View of the value
+	 */
+	[[nodiscard]] constexpr explicit natural_fixed(natural_view value) noexcept
+	{
+		std::ranges::copy_n(std::ranges::begin(value.digits()), static_cast<std::ptrdiff_t>(std::min(N, value.size())), std::ranges::begin(digits_));
+	}
+
+	/**
+	 * Converts a number of another capacity, keeping the `N` least significant limbs.
+	 *
+	 * @param value Number
+	 */
+	template <std::size_t M>
+		requires (M != N)
+	[[nodiscard]] constexpr explicit natural_fixed(const natural_fixed<M> &value) noexcept
+		: natural_fixed(value.view())
+	{
+	}
+
+	/**
+	 * Gets the significant limbs.
+	 *
+	 * @return Limbs up to the most significant nonzero one, starting from the least significant one
+	 */
+	[[nodiscard]] constexpr std::span<const digit_type> digits() const & noexcept
+	{
+		return std::span(digits_).first(used());
+	}
+
+	[[nodiscard]] constexpr size_type size() const noexcept
+	{
+		return used();
+	}
+
+	/**
+	 * Gets a view of the number, which can be operated on together with `natural`.
+	 *
+	 * @return View of the significant limbs
+	 */
+	[[nodiscard]] constexpr natural_view view() const & noexcept
+	{
+		return natural_view::unchecked(digits());
+	}
+
+	[[nodiscard]] constexpr operator natural_view() const & noexcept
+	{
+		return view();
+	}
+
+	[[nodiscard]] constexpr bool is_zero() const noexcept
+	{
+		return std::ranges::all_of(digits_, [](digit_type digit) { return digit == 0; });
+	}
+
+	[[nodiscard]] constexpr bool is_even() const noexcept
+	{
+		return !(digits_[0] & 1);
+	}
+
+	[[nodiscard]] friend constexpr std::strong_ordering operator<=>(const natural_fixed &lhs, const natural_fixed &rhs) noexcept
+	{
+		for (size_type i = N; i-- > 0;)
+		{
+			if (lhs.digits_[i] != rhs.digits_[i])
+			{
+				return lhs.digits_[i] <=> rhs.digits_[i];
+			}
+		}
+
+		return std::strong_ordering::equal;
+	}
+
+	[[nodiscard]] friend constexpr bool operator==(const natural_fixed &lhs, const natural_fixed &rhs) noexcept
+	{
+		return lhs.digits_ == rhs.digits_;
+	}
+
+	constexpr natural_fixed &operator+=(const natural_fixed &other) & noexcept
+	{
+		digit_type carry = 0;
+		for (size_type i = 0; i < N; ++i)
+		{
+			const digit_type sum = digits_[i] + other.digits_[i] + carry;
+			carry = sum >= number_system_base;
+			digits_[i] = sum - (carry ? number_system_base : 0);
+		}
+
+		return *this;
+	}
+
+	constexpr natural_fixed &operator-=(const natural_fixed &other) & noexcept
+	{
+		digit_type borrow = 0;
+		for (size_type i = 0; i < N; ++i)
+		{
+			const digit_type subtrahend = other.digits_[i] + borrow;
+			borrow = digits_[i] < subtrahend;
+			digits_[i] = digits_[i] + (borrow ? number_system_base : 0) - subtrahend;
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Multiplies the number, computing only the `N` least significant limbs of the product.
+	 */
+	constexpr natural_fixed &operator*=(const natural_fixed &other) & noexcept
+	{
+		const auto lhs_size = used();
+		const auto rhs_size = other.used();
+
+		std::array<digit_type, N> product{};
+		for (size_type i = 0; i < lhs_size; ++i)
+		{
+			const wide_type digit = digits_[i];
+			if (digit == 0)
+			{
+				continue;
+			}
+
+			wide_type carry = 0;
+			const auto end = std::min(rhs_size, N - i);
+			for (size_type j = 0; j < end; ++j)
+			{
+				const auto current = digit * other.digits_[j] + product[i + j] + carry;
+				product[i + j] = static_cast<digit_type>(current % number_system_base);
+				carry = current / number_system_base;
+			}
+
+			// the rows above have not reached this limb yet
+			if (i + end < N)
+			{
+				product[i + end] = static_cast<digit_type>(carry);
+			}
+		}
+
+		digits_ = product;
+		return *this;
+	}
+
+	/**
+	 * @note This member function expects `other` to be not zero.
+	 */
+	constexpr natural_fixed &operator/=(const natural_fixed &other) & noexcept
+	{
+		return *this = divide(*this, other).first;
+	}
+
+	/**
+	 * @note This member function expects `other` to be not zero.
+	 */
+	constexpr natural_fixed &operator%=(const natural_fixed &other) & noexcept
+	{
+		return *this = divide(*this, other).second;
+	}
+
+	constexpr natural_fixed &operator++() & noexcept
+	{
+		return *this += natural_fixed(1u);
+	}
+
+	constexpr natural_fixed operator++(int) & noexcept
+	{
+		natural_fixed tmp(*this);
+		++*this;
+		return tmp;
+	}
+
+	constexpr natural_fixed &operator--() & noexcept
+	{
+		return *this -= natural_fixed(1u);
+	}
+
+	constexpr natural_fixed operator--(int) & noexcept
+	{
+		natural_fixed tmp(*this);
+		--*this;
+		return tmp;
+	}
+
+	/**
+	 * Multiplies the number by a power of the number system base.
+	 *
+	 * @param shift Number of limbs to shift by
+	 *
+	 * @return Reference to the instance
+	 */
+	constexpr natural_fixed &operator<<=(std::size_t shift) & noexcept
+	{
+		shift = std::min(shift, N);
+		std::ranges::copy_backward(std::ranges::begin(digits_), std::ranges::end(digits_) - shift, std::ranges::end(digits_));
+		std::ranges::fill_n(std::ranges::begin(digits_), static_cast<std::ptrdiff_t>(shift), digit_type{0});
+		return *this;
+	}
+
+	/**
+	 * Divides the number by a power of the number system base.
+	 *
+	 * @param shift Number of limbs to shift by
+	 *
+	 * @return Reference to the instance
+	 */
+	constexpr natural_fixed &operator>>=(std::size_t shift) & noexcept
+	{
+		shift = std::min(shift, N);
+		std::ranges::copy(std::ranges::begin(digits_) + shift, std::ranges::end(digits_), std::ranges::begin(digits_));
+		std::ranges::fill(std::ranges::end(digits_) - shift, std::ranges::end(digits_), digit_type{0});
+		return *this;
+	}
+
+	/**
+	 * Multiplies the number by a single digit.
+	 *
+	 * @param digit Digit value
+	 *
+	 * @return Reference to the instance
+	 */
+	constexpr natural_fixed &mul_digit(digit_type digit) & noexcept
+	{
+		wide_type carry = 0;
+		for (auto &num_digit : digits_)
+		{
+			const auto current = wide_type{digit} * num_digit + carry;
+			num_digit = static_cast<digit_type>(current % number_system_base);
+			carry = current / number_system_base;
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Divides the number by a single digit.
+	 *
+	 * @param digit Digit value, not zero
+	 *
+	 * @return Remainder of the division
+	 */
+	constexpr digit_type div_digit(digit_type digit) & noexcept
+	{
+		wide_type remainder = 0;
+		for (size_type i = N; i-- > 0;)
+		{
+			const auto current = remainder * number_system_base + digits_[i];
+			digits_[i] = static_cast<digit_type>(current / digit);
+			remainder = current % digit;
+		}
+
+		return static_cast<digit_type>(remainder);
+	}
+
+	/**
+	 * Performs the long division.
+	 *
+	 * @param divisor Divisor, not zero
+	 *
+	 * @return Quotient and remainder
+	 */
+	[[nodiscard]] constexpr std::pair<natural_fixed, natural_fixed> long_div(const natural_fixed &divisor) const noexcept
+	{
+		return divide(*this, divisor);
+	}
+
+	/**
+	 * Performs the division that is known to leave no remainder.
+	 *
+	 * @param divisor Divisor, not zero
+	 *
+	 * @return `*this` div `divisor`
+	 */
+	[[nodiscard]] constexpr natural_fixed divexact(const natural_fixed &divisor) const noexcept
+	{
+		return divide(*this, divisor).first;
+	}
+
+	[[nodiscard]] constexpr natural_fixed operator+(const natural_fixed &other) const noexcept
+	{
+		natural_fixed tmp(*this);
+		tmp += other;
+		return tmp;
+	}
+
+	[[nodiscard]] constexpr natural_fixed operator-(const natural_fixed &other) const noexcept
+	{
+		natural_fixed tmp(*this);
+		tmp -= other;
+		return tmp;
+	}
+
+	[[nodiscard]] constexpr natural_fixed operator*(const natural_fixed &other) const noexcept
+	{
+		natural_fixed tmp(*this);
+		tmp *= other;
+		return tmp;
+	}
+
+	[[nodiscard]] constexpr natural_fixed operator/(const natural_fixed &other) const noexcept
+	{
+		return divide(*this, other).first;
+	}
+
+	[[nodiscard]] constexpr natural_fixed operator%(const natural_fixed &other) const noexcept
+	{
+		return divide(*this, other).second;
+	}
+
+	[[nodiscard]] constexpr natural_fixed operator<<(std::size_t shift) const noexcept
+	{
+		natural_fixed tmp(*this);
+		tmp <<= shift;
+		return tmp;
+	}
+
+	[[nodiscard]] constexpr natural_fixed operator>>(std::size_t shift) const noexcept
+	{
+		natural_fixed tmp(*this);
+		tmp >>= shift;
+		return tmp;
+	}
+
+	friend std::ostream &operator<<(std::ostream &out, const natural_fixed &num)
+	{
+		return out << num.view();
+	}
+};
+}
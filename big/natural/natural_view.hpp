@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+
+namespace big
+{
+/**
+ * Read-only, non-owning view of the digits of a natural number.
+ *
+ * The viewed digits are always normalized: there are no leading zeroes,
+ * and zero is viewed as a single zero digit. Views are cheap to copy and
+ * to narrow, so the parts of a number can be operated on without copying.
+ *
+ * @note The viewed memory must outlive the view and must not change while viewed.
+ */
+class natural_view
+{
+public:
+	using digit_type = std::uint32_t;
+	using size_type = std::size_t;
+
+	static constexpr const digit_type number_system_base = 1'000'000'000;
+	static constexpr const size_type npos = static_cast<size_type>(-1);
+private:
+	static constexpr const digit_type zero_digit[1] = {0};
+
+	std::span<const digit_type> digits_{zero_digit};
+
+	/**
+	 * Erases leading zeroes from the view.
+	 */
+	constexpr void normalize() noexcept
+	{
+		while (std::ranges::size(digits_) > 1 && digits_.back() == 0)
+		{
+			digits_ = digits_.first(std::ranges::size(digits_) - 1);
+		}
+
+		if (std::ranges::empty(digits_) || (std::ranges::size(digits_) == 1 && digits_.front() == 0))
+		{
+			digits_ = zero_digit;
+		}
+	}
+
+	struct trusted_tag
+	{
+	};
+
+	constexpr natural_view(std::span<const digit_type> digits, trusted_tag) noexcept : digits_(digits)
+	{
+		normalize();
+	}
+public:
+	/**
+	 * Constructs the view of zero.
+	 */
+	[[nodiscard]] constexpr natural_view() noexcept = default;
+
+	/**
+	 * Constructs the view of external digits.
+	 *
+	 * @param digits Digits in the number system, starting from the least significant one
+	 *
+	 * @throws `std::invalid_argument` if a digit cannot be represented in the number system
+	 */
+	[[nodiscard]] constexpr explicit natural_view(std::span<const digit_type> digits) : digits_(digits)
+	{
+		for (const auto digit : digits)
+		{
+			if (digit >= number_system_base)
+			{
+				throw std::invalid_argument(
+					"an invalid number, one or more digits cannot be represented in the number system "
+					+ std::to_string(number_system_base));
+			}
+		}
+
+		normalize();
+	}
+
+	/**
+	 * Constructs the view of digits that are known to be valid.
+	 *
+	 * @param digits Digits in the number system, starting from the least significant one
+	 *
+	 * @return View of `digits` with the leading zeroes dropped
+	 */
+	[[nodiscard]] static constexpr natural_view unchecked(std::span<const digit_type> digits) noexcept
+	{
+		return {digits, trusted_tag{}};
+	}
+
+	/**
+	 * Gets the viewed digits.
+	 *
+	 * @return Digits in the number system, starting from the least significant one
+	 */
+	[[nodiscard]] constexpr std::span<const digit_type> digits() const noexcept
+	{
+		return digits_;
+	}
+
+	[[nodiscard]] constexpr size_type size() const noexcept
+	{
+		return std::ranges::size(digits_);
+	}
+
+	[[nodiscard]] constexpr digit_type operator[](size_type pos) const noexcept
+	{
+		return digits_[pos];
+	}
+
+	[[nodiscard]] constexpr bool is_zero() const noexcept
+	{
+		return std::ranges::size(digits_) == 1 && digits_.front() == 0;
+	}
+
+	[[nodiscard]] constexpr bool is_even() const noexcept
+	{
+		return !(digits_.front() & 1);
+	}
+
+	/**
+	 * Narrows the view to a range of digits.
+	 *
+	 * @param pos Position of the lowest digit of the range
+	 * @param len Number of digits in the range, the rest of the digits if `npos`
+	 *
+	 * @return View of `(*this >> pos) mod B^len`, where `B` is the number system base
+	 */
+	[[nodiscard]] constexpr natural_view subview(size_type pos, size_type len = npos) const noexcept
+	{
+		const auto size = std::ranges::size(digits_);
+		if (pos >= size)
+		{
+			return {};
+		}
+
+		return unchecked(digits_.subspan(pos, std::min(len, size - pos)));
+	}
+
+	[[nodiscard]] friend constexpr std::strong_ordering operator<=>(natural_view lhs, natural_view rhs) noexcept
+	{
+		const auto lhs_size = std::ranges::size(lhs.digits_);
+		const auto rhs_size = std::ranges::size(rhs.digits_);
+
+		if (lhs_size != rhs_size)
+		{
+			return lhs_size <=> rhs_size;
+		}
+
+		for (size_type i = lhs_size; i-- > 0;)
+		{
+			if (lhs.digits_[i] != rhs.digits_[i])
+			{
+				return lhs.digits_[i] <=> rhs.digits_[i];
+			}
+		}
+
+		return std::strong_ordering::equal;
+	}
+
+	[[nodiscard]] friend constexpr bool operator==(natural_view lhs, natural_view rhs) noexcept
+	{
+		return lhs <=> rhs == std::strong_ordering::equal;
+	}
+
+	friend std::ostream &operator<<(std::ostream &out, natural_view num);
+};
+
+namespace detail
+{
+/**
+ * Finalizes a hash, so that every bit of the input affects every bit of the result.
+ *
+ * @param h Value to mix
+ *
+ * @return Mixed value
+ */
+[[nodiscard]] constexpr std::uint64_t hash_mix(std::uint64_t h) noexcept
+{
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+/**
+ * Combines a hash into a seed, so that the order of the combined hashes matters.
+ *
+ * @param seed Hash of the preceding values
+ * @param h    Hash of the next value
+ *
+ * @return Combined hash
+ */
+[[nodiscard]] constexpr std::size_t hash_combine(std::size_t seed, std::size_t h) noexcept
+{
+	return static_cast<std::size_t>(hash_mix(seed ^ (h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2))));
+}
+}
+}
+
+/**
+ * Hashes the limbs of a number two at a time.
+ */
+template <>
+struct std::hash<big::natural_view>
+{
+	[[nodiscard]] constexpr std::size_t operator()(big::natural_view value) const noexcept
+	{
+		const auto digits = value.digits();
+		const auto size = std::ranges::size(digits);
+
+		std::uint64_t h = size * 0x9e3779b97f4a7c15ULL;
+		std::size_t i = 0;
+		for (; i + 1 < size; i += 2)
+		{
+			h = (h ^ (std::uint64_t{digits[i + 1]} << 32 | digits[i])) * 0x9fb21c651e98df25ULL;
+			h ^= h >> 29;
+		}
+
+		if (i < size)
+		{
+			h = (h ^ digits[i]) * 0x9fb21c651e98df25ULL;
+		}
+
+		return static_cast<std::size_t>(big::detail::hash_mix(h));
+	}
+};
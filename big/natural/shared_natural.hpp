@@ -0,0 +1,181 @@
+#pragma once
+
+#include <compare>
+#include <memory>
+#include <memory_resource>
+#include "natural.hpp"
+
+
+namespace big
+{
+/**
+ * Natural number with a shared, copy-on-write limb buffer.
+ *
+ * Copies share the same immutable natural, so copying costs O(1) regardless
+ * of the size of the number. The limbs are duplicated only when a shared
+ * value is mutated. Everything that takes `const natural &` accepts it directly.
+ *
+ * @note Copying and mutating the same instance from different threads
+ *       concurrently is a data race, just like for natural.
+ */
+class shared_natural : public conv::stringifiable<shared_natural>
+{
+	std::shared_ptr<natural> value_;
+
+	/**
+	 * Gets the shared canonical zero, so that default construction does not allocate.
+	 *
+	 * @note The zero lives until the process exits, so its limb is allocated
+	 *       from the new-delete resource rather than the current one.
+	 */
+	[[nodiscard]] static const std::shared_ptr<natural> &zero()
+	{
+		static const auto value = []
+		{
+			memory::scoped_resource scope(std::pmr::new_delete_resource());
+			return std::make_shared<natural>();
+		}();
+
+		return value;
+	}
+public:
+	[[nodiscard]] shared_natural() : value_(zero())
+	{
+	}
+
+	[[nodiscard]] shared_natural(natural value) : value_(std::make_shared<natural>(std::move(value)))
+	{
+	}
+
+	/**
+	 * Gets the value.
+	 *
+	 * @return Constant reference to the shared natural
+	 */
+	[[nodiscard]] const natural &get() const & noexcept
+	{
+		return *value_;
+	}
+
+	[[nodiscard]] operator const natural &() const & noexcept
+	{
+		return *value_;
+	}
+
+	[[nodiscard]] const natural &operator*() const & noexcept
+	{
+		return *value_;
+	}
+
+	[[nodiscard]] const natural *operator->() const noexcept
+	{
+		return value_.get();
+	}
+
+	/**
+	 * Gets the value for modification, duplicating the limbs if they are shared.
+	 *
+	 * @return Reference to the natural owned by this instance only
+	 *
+	 * @note The reference is invalidated by copying this instance.
+	 */
+	[[nodiscard]] natural &mutate() &
+	{
+		if (value_.use_count() != 1)
+		{
+			value_ = std::make_shared<natural>(*value_);
+		}
+
+		return *value_;
+	}
+
+	/**
+	 * Moves the value out, duplicating the limbs only if they are shared.
+	 *
+	 * @return Value
+	 */
+	[[nodiscard]] natural release() &&
+	{
+		natural result = value_.use_count() == 1 ? std::move(*value_) : *value_;
+		value_ = zero();
+		return result;
+	}
+
+	/**
+	 * Checks whether the limbs are shared with other instances.
+	 *
+	 * @return `true` if the limbs are shared, `false` otherwise
+	 */
+	[[nodiscard]] bool is_shared() const noexcept
+	{
+		return value_.use_count() != 1;
+	}
+
+	shared_natural &operator+=(const natural &other) &
+	{
+		mutate() += other;
+		return *this;
+	}
+
+	shared_natural &operator-=(const natural &other) &
+	{
+		mutate() -= other;
+		return *this;
+	}
+
+	shared_natural &operator*=(const natural &other) &
+	{
+		mutate() *= other;
+		return *this;
+	}
+
+	shared_natural &operator/=(const natural &other) &
+	{
+		mutate() /= other;
+		return *this;
+	}
+
+	shared_natural &operator%=(const natural &other) &
+	{
+		mutate() %= other;
+		return *this;
+	}
+
+	shared_natural &operator<<=(std::size_t shift) &
+	{
+		mutate() <<= shift;
+		return *this;
+	}
+
+	shared_natural &operator>>=(std::size_t shift) &
+	{
+		mutate() >>= shift;
+		return *this;
+	}
+
+	[[nodiscard]] std::strong_ordering operator<=>(const shared_natural &other) const noexcept
+	{
+		return *value_ <=> *other.value_;
+	}
+
+	[[nodiscard]] bool operator==(const shared_natural &other) const noexcept
+	{
+		return value_ == other.value_ || *value_ == *other.value_;
+	}
+
+	[[nodiscard]] std::strong_ordering operator<=>(const natural &other) const noexcept
+	{
+		return *value_ <=> other;
+	}
+
+	[[nodiscard]] bool operator==(const natural &other) const noexcept
+	{
+		return *value_ == other;
+	}
+
+	friend std::ostream &operator<<(std::ostream &out, const shared_natural &num)
+	{
+		return out << *num.value_;
+	}
+};
+}
@@ -164,6 +164,16 @@ template <typename T>
 [[nodiscard]] constexpr auto distance(const T &a, const T &b) noexcept
 {
 	const auto order = a <=> b;
-	return order == std::strong_ordering::equal ? T{} : order > 0 ? a - b : b - a;
+	if (order == std::strong_ordering::equal)
+	{
+		return T{};
+	}
+
+	if (order > 0)
+	{
+		return a - b;
+	}
+
+	return b - a;
 }
 }
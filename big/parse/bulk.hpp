@@ -0,0 +1,404 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../natural/natural.hpp"
+#include "../natural/natural_array.hpp"
+#include "../integer/integer.hpp"
+#include "../rational/rational.hpp"
+#include "../execution/execution.hpp"
+#include "../memory/mapped_file.hpp"
+
+
+namespace big::parse
+{
+/**
+ * Field of the input that is not a valid number.
+ */
+struct malformed_field
+{
+	// number of the line, starting from one
+	std::size_t line = 0;
+	// position of the first character of the field in the input
+	std::size_t offset = 0;
+	std::string reason;
+
+	[[nodiscard]] friend bool operator==(const malformed_field &, const malformed_field &) = default;
+};
+
+namespace detail
+{
+template <typename T>
+inline constexpr bool is_bulk_loadable = std::same_as<T, natural> || std::same_as<T, integer> || std::same_as<T, rational>;
+
+// inputs shorter than this are not worth splitting between threads
+inline constexpr std::size_t min_bulk_chunk = std::size_t{1} << 16;
+
+[[nodiscard]] constexpr bool is_field_space(char ch) noexcept
+{
+	return ch == ' ' || ch == '\t' || ch == '\r';
+}
+
+[[nodiscard]] constexpr std::string_view trim(std::string_view field) noexcept
+{
+	while (!std::ranges::empty(field) && is_field_space(field.front()))
+	{
+		field.remove_prefix(1);
+	}
+
+	while (!std::ranges::empty(field) && is_field_space(field.back()))
+	{
+		field.remove_suffix(1);
+	}
+
+	return field;
+}
+}
+
+/**
+ * Numbers loaded in bulk, stored in compact arrays.
+ *
+ * Natural numbers are stored in a single `natural_array`, integers as their
+ * absolute values and signs, rational numbers as the absolute values of their
+ * numerators, their denominators and signs. Fractions are stored as written,
+ * they are reduced when a number is copied out of the container.
+ *
+ * @tparam T Type of the numbers, `natural`, `integer` or `rational`
+ */
+template <typename T>
+	requires detail::is_bulk_loadable<T>
+class bulk_numbers
+{
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+
+	// number of stored naturals per value
+	static constexpr size_type parts = std::same_as<T, rational> ? 2 : 1;
+private:
+	std::array<natural_array, parts> parts_;
+	std::vector<std::uint8_t> signs_;
+	std::vector<malformed_field> errors_;
+	// number of lines of the parsed input
+	size_type lines_ = 0;
+
+	/**
+	 * Parses a single field and stores the number or the error.
+	 *
+	 * @param field  Field without the delimiters
+	 * @param line   Number of the line
+	 * @param offset Position of `field` in the input
+	 * @param limbs  Scratch buffers of a numerator and a denominator
+	 */
+	void parse_field(std::string_view field, size_type line, size_type offset, std::array<natural::digits_type, 2> &limbs)
+	{
+		const auto fail = [&](std::string reason)
+		{
+			errors_.push_back({line, offset, std::move(reason)});
+		};
+
+		if (std::ranges::empty(field))
+		{
+			return fail("empty field");
+		}
+
+		bool negative = false;
+		if constexpr (!std::same_as<T, natural>)
+		{
+			if (field.front() == '-' || field.front() == '+')
+			{
+				negative = field.front() == '-';
+				field.remove_prefix(1);
+			}
+		}
+
+		std::string_view numerator = field;
+		std::string_view denominator;
+		auto slash = std::string_view::npos;
+
+		if constexpr (std::same_as<T, rational>)
+		{
+			slash = field.find('/');
+			if (slash != std::string_view::npos)
+			{
+				numerator = field.substr(0, slash);
+				denominator = field.substr(slash + 1);
+			}
+		}
+
+		if (!natural::pack_decimal(numerator, limbs[0]))
+		{
+			return fail("invalid number, one or more characters are not a digit");
+		}
+
+		const auto numerator_view = natural_view::unchecked(limbs[0]);
+		negative = negative && !numerator_view.is_zero();
+
+		if constexpr (std::same_as<T, rational>)
+		{
+			if (slash == std::string_view::npos)
+			{
+				limbs[1].assign(1, 1);
+			}
+			else if (std::ranges::empty(denominator))
+			{
+				return fail("empty denominator");
+			}
+			else if (!natural::pack_decimal(denominator, limbs[1]))
+			{
+				return fail("invalid denominator, one or more characters are not a digit");
+			}
+
+			const auto denominator_view = natural_view::unchecked(limbs[1]);
+			if (denominator_view.is_zero())
+			{
+				return fail("denominator is zero");
+			}
+
+			parts_[1].push_back(denominator_view);
+		}
+
+		parts_[0].push_back(numerator_view);
+		if constexpr (!std::same_as<T, natural>)
+		{
+			signs_.push_back(negative);
+		}
+	}
+
+	/**
+	 * Parses whole lines of the input.
+	 *
+	 * @param text      Lines, the last one may lack a line break
+	 * @param offset    Position of `text` in the input
+	 * @param delimiter Character separating the fields of a line
+	 */
+	void parse_lines(std::string_view text, size_type offset, char delimiter)
+	{
+		std::array<natural::digits_type, 2> limbs;
+
+		for (size_type begin = 0; begin < std::ranges::size(text);)
+		{
+			const auto end = std::min(text.find('\n', begin), std::ranges::size(text));
+			const auto line = text.substr(begin, end - begin);
+			++lines_;
+
+			// blank lines are skipped, but an empty field between delimiters is malformed
+			if (!std::ranges::empty(detail::trim(line)))
+			{
+				for (size_type field_begin = 0;;)
+				{
+					const auto field_end = std::min(line.find(delimiter, field_begin), std::ranges::size(line));
+					const auto raw = line.substr(field_begin, field_end - field_begin);
+					const auto field = detail::trim(raw);
+					const auto field_offset = offset + begin + field_begin + (std::ranges::empty(field) ? 0 : field.data() - raw.data());
+
+					parse_field(field, lines_, field_offset, limbs);
+
+					if (field_end == std::ranges::size(line))
+					{
+						break;
+					}
+
+					field_begin = field_end + 1;
+				}
+			}
+
+			begin = end + 1;
+		}
+	}
+
+	/**
+	 * Moves the numbers and the errors of the following part of the input to the end.
+	 *
+	 * @param other Numbers parsed from the input that follows the input of this container
+	 */
+	void append(bulk_numbers &&other)
+	{
+		for (size_type part = 0; part < parts; ++part)
+		{
+			parts_[part].append(other.parts_[part]);
+		}
+
+		signs_.insert(std::ranges::end(signs_), std::ranges::begin(other.signs_), std::ranges::end(other.signs_));
+
+		for (auto &error : other.errors_)
+		{
+			error.line += lines_;
+			errors_.push_back(std::move(error));
+		}
+
+		lines_ += other.lines_;
+	}
+public:
+	[[nodiscard]] bulk_numbers() = default;
+
+	/**
+	 * Parses numbers from text in parallel.
+	 *
+	 * The text is split into a chunk per thread at line boundaries, the chunks
+	 * are parsed into their own containers, which are then concatenated in order.
+	 * Every line holds numbers separated by the delimiter, blank lines are skipped,
+	 * and spaces, tabs and carriage returns around the numbers are ignored.
+	 * Integers may have a sign, rational numbers may also have a denominator after a slash.
+	 *
+	 * @param text      Input text
+	 * @param delimiter Character separating the numbers of a line
+	 * @param policy    Execution policy to parse the chunks under
+	 *
+	 * @note Malformed fields do not stop parsing, they are skipped and listed by `errors`.
+	 */
+	[[nodiscard]] explicit bulk_numbers(std::string_view text, char delimiter = ',',
+		const execution::policy &policy = execution::default_policy())
+	{
+		const auto size = std::ranges::size(text);
+		const auto chunks = std::clamp<size_type>(size / detail::min_bulk_chunk, 1, policy.concurrency());
+
+		std::vector<size_type> bounds(chunks + 1, size);
+		bounds[0] = 0;
+
+		for (size_type i = 1; i < chunks; ++i)
+		{
+			const auto line_break = text.find('\n', std::max(size / chunks * i, bounds[i - 1]));
+			bounds[i] = line_break == std::string_view::npos ? size : line_break + 1;
+		}
+
+		auto parsed = memory::make_unscoped<std::vector<bulk_numbers>>(chunks);
+		execution::parallel_for(policy, chunks, 1, [&](size_type begin, size_type end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				parsed[i].parse_lines(text.substr(bounds[i], bounds[i + 1] - bounds[i]), bounds[i], delimiter);
+			}
+		});
+
+		*this = std::move(parsed.front());
+		for (size_type i = 1; i < chunks; ++i)
+		{
+			append(std::move(parsed[i]));
+		}
+	}
+
+	[[nodiscard]] size_type size() const noexcept
+	{
+		return parts_[0].size();
+	}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	/**
+	 * Gets a stored natural number.
+	 *
+	 * @param index Index of the number
+	 * @param part  0 for the absolute value or the numerator, 1 for the denominator
+	 *
+	 * @return View of the stored natural number
+	 */
+	[[nodiscard]] natural_view view(size_type index, size_type part = 0) const noexcept
+	{
+		return parts_[part][index];
+	}
+
+	/**
+	 * Gets the sign bit of a number.
+	 *
+	 * @param index Index of the number
+	 *
+	 * @return `true` if the number is negative
+	 */
+	[[nodiscard]] bool sign_bit(size_type index) const noexcept
+	{
+		if constexpr (std::same_as<T, natural>)
+		{
+			return false;
+		}
+		else
+		{
+			return signs_[index] != 0;
+		}
+	}
+
+	/**
+	 * Copies a number out of the container.
+	 *
+	 * @param index Index of the number
+	 *
+	 * @return Number
+	 */
+	[[nodiscard]] T operator[](size_type index) const
+	{
+		if constexpr (std::same_as<T, natural>)
+		{
+			return natural(view(index));
+		}
+		else if constexpr (std::same_as<T, integer>)
+		{
+			return integer(natural(view(index)), sign_bit(index));
+		}
+		else
+		{
+			return rational(integer(natural(view(index, 0)), sign_bit(index)), natural(view(index, 1)));
+		}
+	}
+
+	/**
+	 * Gets the stored natural numbers.
+	 *
+	 * @param part 0 for the absolute values or the numerators, 1 for the denominators
+	 *
+	 * @return Array of the natural numbers
+	 */
+	[[nodiscard]] const natural_array &values(size_type part = 0) const noexcept
+	{
+		return parts_[part];
+	}
+
+	/**
+	 * Gets the malformed fields of the input.
+	 *
+	 * @return Malformed fields in the order of the input
+	 */
+	[[nodiscard]] const std::vector<malformed_field> &errors() const noexcept
+	{
+		return errors_;
+	}
+};
+
+/**
+ * Loads numbers from a text file in parallel.
+ *
+ * The file is memory-mapped and parsed as by the constructor of `bulk_numbers`,
+ * so its contents are never copied into an intermediate string.
+ *
+ * @tparam T Type of the numbers, `natural`, `integer` or `rational`
+ *
+ * @param path      Path of the file
+ * @param delimiter Character separating the numbers of a line
+ * @param policy    Execution policy to parse the chunks of the file under
+ *
+ * @return Loaded numbers and the malformed fields of the file
+ *
+ * @throws `std::system_error` if the file cannot be mapped
+ */
+template <typename T>
+	requires detail::is_bulk_loadable<T>
+[[nodiscard]] bulk_numbers<T> load_numbers(const std::filesystem::path &path, char delimiter = ',',
+	const execution::policy &policy = execution::default_policy())
+{
+	const memory::mapped_file file(path);
+	file.advise_sequential();
+
+	const auto bytes = file.bytes();
+	return bulk_numbers<T>(std::string_view(reinterpret_cast<const char *>(std::ranges::data(bytes)), std::ranges::size(bytes)),
+		delimiter, policy);
+}
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <istream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include "../natural/natural.hpp"
+
+
+namespace big::parse
+{
+/**
+ * Incremental parser of decimal natural numbers.
+ *
+ * Digits are consumed in chunks of any size, most significant first, and are
+ * packed into limbs right away, so only the limbs of the number are kept in
+ * memory. As the number of digits is unknown until the end, the limbs are
+ * aligned to the first digit and are realigned to the last one by `finish`,
+ * with a single multiplication by a power of ten.
+ */
+class decimal_parser
+{
+public:
+	using digit_type = natural::digit_type;
+	using size_type = std::size_t;
+private:
+	static constexpr std::array<digit_type, natural::bits_per_num + 1> powers_of_ten{
+		1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000, 1'000'000'000
+	};
+
+	// full limbs, the most significant one first
+	natural::digits_type limbs_;
+	// digits that do not form a full limb yet
+	digit_type pending_ = 0;
+	std::uint8_t pending_size_ = 0;
+	size_type size_ = 0;
+public:
+	/**
+	 * Consumes a single digit.
+	 *
+	 * @param ch Decimal digit character
+	 *
+	 * @throws `std::invalid_argument` if `ch` is not a decimal digit
+	 */
+	void push(char ch)
+	{
+		if (ch < '0' || ch > '9')
+		{
+			throw std::invalid_argument("invalid number, one or more characters are not a digit");
+		}
+
+		++size_;
+
+		// leading zeroes do not need to be stored
+		if (pending_size_ == 0 && ch == '0' && std::ranges::empty(limbs_))
+		{
+			return;
+		}
+
+		pending_ = pending_ * 10 + static_cast<digit_type>(ch - '0');
+		if (++pending_size_ == natural::bits_per_num)
+		{
+			limbs_.push_back(pending_);
+			pending_ = 0;
+			pending_size_ = 0;
+		}
+	}
+
+	/**
+	 * Consumes a chunk of digits.
+	 *
+	 * @param chunk Decimal digits, continuing the ones consumed before
+	 *
+	 * @throws `std::invalid_argument` if `chunk` contains a character that is not a decimal digit
+	 */
+	void feed(std::string_view chunk)
+	{
+		for (const auto ch : chunk)
+		{
+			push(ch);
+		}
+	}
+
+	/**
+	 * Gets the number of consumed digits.
+	 *
+	 * @return Number of digits, including the leading zeroes
+	 */
+	[[nodiscard]] size_type size() const noexcept
+	{
+		return size_;
+	}
+
+	/**
+	 * Builds the number from the consumed digits.
+	 *
+	 * @return Number
+	 *
+	 * @throws `std::invalid_argument` if no digits were consumed
+	 */
+	[[nodiscard]] natural finish() &&
+	{
+		if (size_ == 0)
+		{
+			throw std::invalid_argument("cannot build num from empty string");
+		}
+
+		std::ranges::reverse(limbs_);
+
+		natural result(std::move(limbs_));
+		if (pending_size_ != 0)
+		{
+			result.mul_digit(powers_of_ten[pending_size_]);
+			result += pending_;
+		}
+
+		return result;
+	}
+};
+
+/**
+ * Consumes the decimal digits that a stream buffer continues with.
+ *
+ * @param buffer Stream buffer, left at the first character that is not a digit
+ * @param parser Parser to feed the digits to
+ *
+ * @return Number of consumed digits
+ */
+inline std::size_t read_decimal(std::streambuf &buffer, decimal_parser &parser)
+{
+	using traits = std::streambuf::traits_type;
+
+	std::size_t count = 0;
+	for (auto ch = buffer.sgetc(); ch != traits::eof() && ch >= '0' && ch <= '9'; ch = buffer.snextc())
+	{
+		parser.push(traits::to_char_type(ch));
+		++count;
+	}
+
+	return count;
+}
+
+/**
+ * Consumes the decimal digits that a stream continues with.
+ *
+ * @param in     Input stream, `eofbit` is set if the digits end the stream
+ * @param parser Parser to feed the digits to
+ *
+ * @return Number of consumed digits
+ */
+inline std::size_t read_decimal(std::istream &in, decimal_parser &parser)
+{
+	const auto count = read_decimal(*in.rdbuf(), parser);
+
+	if (std::istream::traits_type::eq_int_type(in.rdbuf()->sgetc(), std::istream::traits_type::eof()))
+	{
+		in.setstate(std::ios::eofbit);
+	}
+
+	return count;
+}
+
+/**
+ * Parses a decimal natural number supplied in chunks.
+ *
+ * @tparam F Function type
+ *
+ * @param next_chunk Function returning the next chunk of digits, an empty one at the end
+ *
+ * @return Number
+ *
+ * @throws `std::invalid_argument` if a chunk contains a character that is not a decimal digit or there are no digits
+ */
+template <std::invocable F>
+	requires std::convertible_to<std::invoke_result_t<F &>, std::string_view>
+[[nodiscard]] natural parse_decimal(F &&next_chunk)
+{
+	decimal_parser parser;
+
+	for (std::string_view chunk = next_chunk(); !std::ranges::empty(chunk); chunk = next_chunk())
+	{
+		parser.feed(chunk);
+	}
+
+	return std::move(parser).finish();
+}
+
+/**
+ * Parses a decimal natural number from the rest of a stream.
+ *
+ * @param in Input stream, whitespace around the digits is ignored
+ *
+ * @return Number
+ *
+ * @throws `std::invalid_argument` if the stream contains anything but whitespace and a single run of decimal digits
+ */
+[[nodiscard]] inline natural parse_decimal(std::istream &in)
+{
+	decimal_parser parser;
+
+	in >> std::ws;
+	read_decimal(in, parser);
+	in >> std::ws;
+
+	if (!in.eof())
+	{
+		throw std::invalid_argument("invalid number, one or more characters are not a digit");
+	}
+
+	return std::move(parser).finish();
+}
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include "../natural/natural.hpp"
+#include "../integer/integer.hpp"
+#include "../rational/rational.hpp"
+#include "../algorithm/algorithm.hpp"
+
+
+/**
+ * Literals of big numbers, parsed at compile time.
+ *
+ * The digits of a literal are packed into limbs during compilation, so
+ * creating the number at run time only copies its limbs. The literals are
+ * found by `using namespace big::literals` as well as by `using namespace big`.
+ */
+namespace big::inline literals
+{
+namespace literals_detail
+{
+/**
+ * String literal passed as a template argument.
+ *
+ * @tparam N Size of the literal, including the terminating null character
+ */
+template <std::size_t N>
+struct fixed_string
+{
+	std::array<char, N> chars{};
+
+	consteval fixed_string(const char (&str)[N]) noexcept
+	{
+		std::ranges::copy(str, std::ranges::begin(chars));
+	}
+
+	[[nodiscard]] constexpr std::string_view view() const noexcept
+	{
+		return {std::ranges::data(chars), N - 1};
+	}
+};
+
+/**
+ * Checks the characters of an integer literal for being decimal digits, possibly separated by quotes.
+ */
+template <char... Chars>
+[[nodiscard]] consteval bool is_decimal_literal() noexcept
+{
+	constexpr std::array<char, sizeof...(Chars)> chars{Chars...};
+
+	// a leading zero starts an octal, hexadecimal or binary literal
+	if (chars.front() == '0' && chars.size() > 1)
+	{
+		return false;
+	}
+
+	return std::ranges::all_of(chars, [](char ch) { return (ch >= '0' && ch <= '9') || ch == '\''; });
+}
+
+/**
+ * Digits of an integer literal without the digit separators.
+ */
+template <char... Chars>
+inline constexpr auto literal_digits = []
+{
+	constexpr std::array<char, sizeof...(Chars)> chars{Chars...};
+
+	std::array<char, sizeof...(Chars) - static_cast<std::size_t>(std::ranges::count(chars, '\''))> digits{};
+	std::ranges::remove_copy(chars, std::ranges::begin(digits), '\'');
+	return digits;
+}();
+
+/**
+ * Copies the limbs of a number into an array.
+ *
+ * @tparam N Number of limbs
+ *
+ * @param value Number of `N` limbs
+ *
+ * @return Limbs of `value`
+ */
+template <std::size_t N>
+[[nodiscard]] constexpr std::array<natural::digit_type, N> to_array(natural_view value) noexcept
+{
+	std::array<natural::digit_type, N> result{};
+	std::ranges::copy(value.digits(), std::ranges::begin(result));
+	return result;
+}
+
+template <char... Chars>
+[[nodiscard]] constexpr natural literal_value()
+{
+	return natural(std::string_view(std::ranges::data(literal_digits<Chars...>), std::ranges::size(literal_digits<Chars...>)));
+}
+
+/**
+ * Parses a fraction `[sign]numerator[/denominator]` and reduces it.
+ *
+ * @tparam Str Fraction
+ *
+ * @param part 0 for the numerator, 1 for the denominator
+ *
+ * @return Absolute value of the numerator or the denominator of the reduced fraction
+ *
+ * @throws `std::invalid_argument` if the fraction is malformed
+ * @throws `std::domain_error` if the denominator is zero
+ */
+template <fixed_string Str>
+[[nodiscard]] constexpr natural fraction_part(std::size_t part)
+{
+	auto str = Str.view();
+	if (!std::ranges::empty(str) && (str.front() == '-' || str.front() == '+'))
+	{
+		str.remove_prefix(1);
+	}
+
+	const auto slash = str.find('/');
+	const natural numerator(str.substr(0, slash));
+	natural denominator(1u);
+	if (slash != std::string_view::npos)
+	{
+		denominator = natural(str.substr(slash + 1));
+	}
+
+	if (denominator.is_zero())
+	{
+		throw std::domain_error("denominator cannot be zero");
+	}
+
+	const auto divisor = algorithm::gcd(numerator, denominator);
+	if (part == 0)
+	{
+		return numerator / divisor;
+	}
+
+	return denominator / divisor;
+}
+
+// limbs of the literals, computed during compilation
+template <char... Chars>
+inline constexpr auto literal_limbs = to_array<literal_value<Chars...>().digits().size()>(literal_value<Chars...>());
+
+template <fixed_string Str, std::size_t Part>
+inline constexpr auto fraction_limbs = to_array<fraction_part<Str>(Part).digits().size()>(fraction_part<Str>(Part));
+
+template <std::size_t N>
+[[nodiscard]] constexpr natural from_limbs(const std::array<natural::digit_type, N> &limbs)
+{
+	return natural(natural_view::unchecked(limbs));
+}
+}
+
+/**
+ * Natural number literal, such as `123456789012345678901234567890_n`.
+ *
+ * @return Number
+ */
+template <char... Chars>
+[[nodiscard]] constexpr natural operator""_n()
+{
+	static_assert(literals_detail::is_decimal_literal<Chars...>(), "big number literals must be decimal");
+	return literals_detail::from_limbs(literals_detail::literal_limbs<Chars...>);
+}
+
+/**
+ * Integer literal, such as `-123456789012345678901234567890_z`, where the minus is the unary operator.
+ *
+ * @return Number
+ */
+template <char... Chars>
+[[nodiscard]] constexpr integer operator""_z()
+{
+	static_assert(literals_detail::is_decimal_literal<Chars...>(), "big number literals must be decimal");
+	return integer(literals_detail::from_limbs(literals_detail::literal_limbs<Chars...>));
+}
+
+/**
+ * Rational literal of an integer value, such as `5_q`.
+ *
+ * @return Number
+ */
+template <char... Chars>
+[[nodiscard]] constexpr rational operator""_q()
+{
+	static_assert(literals_detail::is_decimal_literal<Chars...>(), "big number literals must be decimal");
+	rational result;
+	result.numerator() = integer(literals_detail::from_limbs(literals_detail::literal_limbs<Chars...>));
+	return result;
+}
+
+/**
+ * Rational literal of a fraction, such as `"-22/7"_q`.
+ *
+ * The fraction is reduced during compilation, a malformed fraction or
+ * a zero denominator fails the compilation.
+ *
+ * @return Number
+ */
+template <literals_detail::fixed_string Str>
+[[nodiscard]] constexpr rational operator""_q()
+{
+	constexpr bool negative = Str.view().starts_with('-') && !natural_view::unchecked(literals_detail::fraction_limbs<Str, 0>).is_zero();
+
+	rational result;
+	result.numerator() = integer(literals_detail::from_limbs(literals_detail::fraction_limbs<Str, 0>), negative);
+	result.denominator() = literals_detail::from_limbs(literals_detail::fraction_limbs<Str, 1>);
+	return result;
+}
+}
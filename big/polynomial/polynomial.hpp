@@ -4,6 +4,8 @@
 #include "../numeric/numeric.hpp"
 #include "../numeric/polynomial.hpp"
 #include "../algorithm/container.hpp"
+#include "../execution/execution.hpp"
+#include "../memory/allocator.hpp"
 #include <map>
 
 
@@ -14,7 +16,10 @@ namespace big
  */
 class polynomial : public conv::stringifiable<polynomial>
 {
-	std::vector<rational> coefficients_;
+public:
+	using coefficients_type = std::vector<rational, memory::aligned_allocator<rational>>;
+private:
+	coefficients_type coefficients_;
 
 	constexpr void erase_leading_zeroes() &
 	{
@@ -32,6 +37,8 @@ class polynomial : public conv::stringifiable<polynomial>
 public:
 	using size_type = std::size_t;
 
+	static constexpr size_type parallel_threshold = 32;
+
 	[[nodiscard]] constexpr polynomial() noexcept
 		: coefficients_(1, rational{})
 	{}
@@ -72,7 +79,7 @@ public:
 	 *
 	 * @return Coefficients
 	 */
-	[[nodiscard]] constexpr const std::vector<rational> &coefficients() const & noexcept
+	[[nodiscard]] constexpr const coefficients_type &coefficients() const & noexcept
 	{
 		return coefficients_;
 	}
@@ -89,14 +96,19 @@ public:
 	    return std::ranges::size(coefficients_) - 1;
 	}
 
-	[[nodiscard]] constexpr std::strong_ordering operator<=>(const polynomial &other) const & noexcept
+	/**
+	 * Orders the polynomials by their degrees.
+	 *
+	 * @note Polynomials of the same degree are equivalent, but equal only if all of their coefficients are.
+	 */
+	[[nodiscard]] constexpr std::weak_ordering operator<=>(const polynomial &other) const & noexcept
 	{
 		return degree() <=> other.degree();
 	}
 
 	[[nodiscard]] constexpr bool operator==(const polynomial &other) const & noexcept
 	{
-		return *this <=> other == std::strong_ordering::equal;
+		return coefficients_ == other.coefficients_;
 	}
 
 	/**
@@ -249,7 +261,7 @@ public:
 		const auto &cur_len = std::ranges::size(coefficients_);
 		const auto &other_len = std::ranges::size(other.coefficients_);
 
-		std::vector<rational> result(cur_len + other_len - 1);
+		coefficients_type result(cur_len + other_len - 1);
 
 		for (size_type i = 0; i < cur_len; ++i)
 		{
@@ -265,6 +277,51 @@ public:
 		return *this;
 	}
 
+	/**
+	 * Multiplies the polynomial under the given execution policy.
+	 *
+	 * The coefficients of the product are independent of each other, so they are
+	 * split into chunks computed on the pool of the policy once both factors have
+	 * at least `parallel_threshold` coefficients.
+	 *
+	 * @param other  Multiplier
+	 * @param policy Execution policy
+	 *
+	 * @return Reference to the instance
+	 */
+	polynomial &multiply(const polynomial &other, const execution::policy &policy) &
+	{
+		const auto cur_len = std::ranges::size(coefficients_);
+		const auto other_len = std::ranges::size(other.coefficients_);
+
+		if (std::min(cur_len, other_len) < parallel_threshold)
+		{
+			execution::scoped_policy scope(policy);
+			return *this *= other;
+		}
+
+		auto result = memory::make_unscoped<coefficients_type>(cur_len + other_len - 1);
+
+		execution::parallel_for(policy, std::ranges::size(result), 1, [&](size_type begin, size_type end)
+		{
+			for (size_type k = begin; k < end; ++k)
+			{
+				const auto first = k < other_len ? 0 : k - other_len + 1;
+				const auto last = std::min(k, cur_len - 1);
+
+				for (size_type i = first; i <= last; ++i)
+				{
+					result[k] += coefficients_[i] * other.coefficients_[k - i];
+				}
+			}
+		});
+
+		coefficients_ = std::move(result);
+		erase_leading_zeroes();
+
+		return *this;
+	}
+
 	/**
 	 * @note DIV_PP_P
 	 */
@@ -385,6 +442,60 @@ public:
 		return {quotient, remainder};
 	}
 
+	/**
+	 * Performs polynomial long division under the given execution policy.
+	 *
+	 * Every step of the division updates the coefficients of the remainder independently,
+	 * so the updates are split into chunks computed on the pool of the policy once
+	 * the divisor has at least `parallel_threshold` coefficients.
+	 *
+	 * @param divisor The divisor polynomial for the division
+	 * @param policy  Execution policy
+	 *
+	 * @return A pair of polynomials where the first element is the quotient and the second element is the remainder
+	 */
+	[[nodiscard]] std::pair<polynomial, polynomial> long_div(const polynomial &divisor, const execution::policy &policy) const &
+	{
+		if (std::ranges::size(divisor.coefficients_) < parallel_threshold
+			|| numeric::polynomial::degree(divisor) > numeric::polynomial::degree(*this))
+		{
+			execution::scoped_policy scope(policy);
+			return long_div(divisor);
+		}
+
+		const auto divisor_degree = numeric::polynomial::degree(divisor);
+
+		auto remainder = memory::make_unscoped<polynomial>(*this);
+		polynomial quotient{};
+
+		quotient <<= numeric::polynomial::degree(remainder) - divisor_degree;
+
+		while (numeric::polynomial::degree(remainder) >= divisor_degree && !numeric::is_zero(remainder.major_coefficient()))
+		{
+			const auto new_coefficient = remainder.major_coefficient() / divisor.major_coefficient();
+			const auto degree = numeric::polynomial::degree(remainder) - divisor_degree;
+
+			numeric::polynomial::coefficient_at(quotient, degree) = new_coefficient;
+
+			execution::parallel_for(policy, divisor_degree, 1, [&](size_type begin, size_type end)
+			{
+				for (size_type i = begin; i < end; ++i)
+				{
+					remainder.coefficients_[degree + i] -= new_coefficient * divisor.coefficients_[i];
+				}
+			});
+
+			// the leading coefficient is cancelled by construction
+			remainder.coefficients_.back() = rational{};
+			remainder.erase_leading_zeroes();
+		}
+
+		quotient.erase_leading_zeroes();
+		remainder.erase_leading_zeroes();
+
+		return {quotient, remainder};
+	}
+
 	/**
 	 * @note MUL_PQ_P
 	 */
@@ -431,3 +542,18 @@ public:
 	friend std::ostream &operator<<(std::ostream &os, const polynomial &polynomial);
 };
 }
+
+template <>
+struct std::hash<big::polynomial>
+{
+	[[nodiscard]] constexpr std::size_t operator()(const big::polynomial &value) const noexcept
+	{
+		std::size_t h = 0;
+		for (const auto &coefficient : value.coefficients())
+		{
+			h = big::detail::hash_combine(h, std::hash<big::rational>{}(coefficient));
+		}
+
+		return h;
+	}
+};
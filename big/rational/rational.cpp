@@ -1,5 +1,6 @@
 #include "rational.hpp"
 #include "numeric/rational.hpp"
+#include "../parse/decimal.hpp"
 #include <sstream>
 
 namespace big
@@ -15,4 +16,39 @@ std::ostream &operator<<(std::ostream &out, const rational &num)
 
 	return out << '/' << numeric::rational::denominator(num);
 }
+
+std::istream &operator>>(std::istream &in, rational &num)
+{
+	integer numerator;
+	if (!(in >> numerator))
+	{
+		return in;
+	}
+
+	auto &buffer = *in.rdbuf();
+	if (in.eof() || buffer.sgetc() != '/')
+	{
+		num = rational(numerator);
+		return in;
+	}
+
+	buffer.sbumpc();
+
+	parse::decimal_parser parser;
+	if (parse::read_decimal(in, parser) == 0)
+	{
+		in.setstate(std::ios::failbit);
+		return in;
+	}
+
+	const auto denominator = std::move(parser).finish();
+	if (denominator.is_zero())
+	{
+		in.setstate(std::ios::failbit);
+		return in;
+	}
+
+	num = rational(numerator, denominator);
+	return in;
+}
 }
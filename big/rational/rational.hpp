@@ -34,8 +34,13 @@ class rational : public conv::stringifiable<rational>
 	constexpr void simplify_fraction() & noexcept
 	{
 		const auto coefficient = algorithm::gcd(numeric::abs(numerator_), numeric::abs(denominator_));
-		numerator_ /= coefficient;
-		denominator_ /= coefficient;
+		if (coefficient == 1)
+		{
+			return;
+		}
+
+		numerator_ = algorithm::divexact(numerator_, integer(coefficient));
+		denominator_ = algorithm::divexact(denominator_, coefficient);
 	}
 
 public:
@@ -274,6 +279,14 @@ public:
 
 	friend std::ostream &operator<<(std::ostream &out, const rational &num);
 
+	/**
+	 * Reads a fraction `numerator/denominator` or an integer.
+	 *
+	 * @note Sets `failbit` and leaves `num` unchanged if the stream does not continue
+	 *       with a number or the denominator is zero.
+	 */
+	friend std::istream &operator>>(std::istream &in, rational &num);
+
 	template <std::integral T>
 	[[nodiscard]] explicit operator T() const & noexcept
 	{
@@ -281,3 +294,12 @@ public:
 	}
 };
 }
+
+template <>
+struct std::hash<big::rational>
+{
+	[[nodiscard]] constexpr std::size_t operator()(const big::rational &value) const noexcept
+	{
+		return big::detail::hash_combine(std::hash<big::integer>{}(value.numerator()), std::hash<big::natural>{}(value.denominator()));
+	}
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <concepts>
+#include <type_traits>
+#include <utility>
 #include "../numeric/numeric.hpp"
 #include "natural.hpp"
 
@@ -12,4 +15,14 @@ concept integer_like = requires (T t)
 	numeric::sign(t);
 	numeric::abs(t);
 };
+
+/**
+ * Integer-like type, the absolute value of which is an arbitrary precision `natural`.
+ *
+ * Algorithms that work on the limbs of `natural` directly are constrained by
+ * this concept, so that fixed-width numbers are rejected at the interface.
+ */
+template <typename T>
+concept unbounded_integer_like = integer_like<T>
+	&& std::same_as<std::remove_cvref_t<decltype(numeric::abs(std::declval<const T &>()))>, natural>;
 }
@@ -1,10 +1,22 @@
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
 #include "../natural/natural.hpp"
+#include "../natural/natural_fixed.hpp"
 
 
 namespace big::traits
 {
+namespace detail
+{
+template <typename T>
+inline constexpr bool is_natural_fixed = false;
+
+template <std::size_t N>
+inline constexpr bool is_natural_fixed<natural_fixed<N>> = true;
+}
+
 template <typename T>
-concept natural_like = std::same_as<std::remove_cvref_t<T>, natural>;
+concept natural_like = std::same_as<std::remove_cvref_t<T>, natural> || detail::is_natural_fixed<std::remove_cvref_t<T>>;
 }
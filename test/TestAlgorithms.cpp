@@ -1,7 +1,20 @@
 #include <valarray>
 #include <chrono>
+#include <random>
+#include <unordered_set>
+#include <atomic>
+#include <thread>
 #include "../big/algorithm/algorithm.hpp"
+#include "../big/algorithm/root.hpp"
+#include "../big/algorithm/perfect_power.hpp"
+#include "../big/algorithm/prime.hpp"
+#include "../big/algorithm/combinatorics.hpp"
+#include "../big/algorithm/reduce.hpp"
+#include "../big/algorithm/remainder_tree.hpp"
+#include "../big/algorithm/sort.hpp"
 #include "../big/natural/natural.hpp"
+#include "../big/natural/natural_fixed.hpp"
+#include "../big/integer/integer_fixed.hpp"
 #include "../big/rational/rational.hpp"
 #include "../big/polynomial/polynomial.hpp"
 #include "gtest/gtest.h"
@@ -21,6 +34,442 @@ TEST(AlgorithmTestSuite, TestLcm)
 	EXPECT_EQ(algorithm::lcm(natural("12265103118755758026325601433600"), natural("565646")), natural("3468853259355859752279485574255052800"));
 }
 
+TEST(AlgorithmTestSuite, TestDivexact)
+{
+	using namespace big;
+
+	EXPECT_EQ(algorithm::divexact(natural(0), natural(7)), natural(0));
+	EXPECT_EQ(algorithm::divexact(natural(91), natural(7)), natural(13));
+	EXPECT_EQ(algorithm::divexact(natural("3468853259355859752279485574255052800"), natural("565646")), natural("6132551559377879013162800716800"));
+	EXPECT_EQ(algorithm::divexact(natural("3468853259355859752279485574255052800"), natural("12265103118755758026325601433600")), natural("282823"));
+
+	{
+		const natural a("48123749817263487162398476123987461293846391");
+		const natural b("714263874612000000000000000000000000000000000000000");
+		const natural c("1024000000000000000009765625");
+
+		EXPECT_EQ(algorithm::divexact(a * b, b), a);
+		EXPECT_EQ(algorithm::divexact(a * b, a), b);
+		EXPECT_EQ(algorithm::divexact(a * c, c), a);
+		EXPECT_EQ(algorithm::divexact(a * b * c, a * c), b);
+	}
+
+	EXPECT_EQ(algorithm::divexact(integer(-91), integer(7)), integer(-13));
+	EXPECT_EQ(algorithm::divexact(integer(-91), integer(-7)), integer(13));
+	EXPECT_EQ(algorithm::divexact(integer(0), integer(-7)), integer(0));
+	EXPECT_FALSE(algorithm::divexact(integer(0), integer(-7)).sign_bit());
+
+	EXPECT_THROW(static_cast<void>(algorithm::divexact(natural(5), natural(0))), std::domain_error);
+}
+
+TEST(AlgorithmTestSuite, TestDecimalShift)
+{
+	using namespace big;
+
+	EXPECT_EQ(algorithm::decimal_shift(natural(0), 25).str(), "0");
+	EXPECT_EQ(algorithm::decimal_shift(natural(123), 0).str(), "123");
+	EXPECT_EQ(algorithm::decimal_shift(natural(123), 4).str(), "1230000");
+	EXPECT_EQ(algorithm::decimal_shift(natural(123), 9).str(), "123000000000");
+	EXPECT_EQ(algorithm::decimal_shift(natural("987654321987654321"), 22).str(), "9876543219876543210000000000000000000000");
+	EXPECT_EQ(algorithm::decimal_shift(integer(-45), 10).str(), "-450000000000");
+	EXPECT_EQ(algorithm::decimal_shift(rational(-3, 40u), 3).str(), "-75");
+
+	EXPECT_EQ(algorithm::decimal_shift_right(natural("9876543219876543210000000000000000000000"), 22).str(), "987654321987654321");
+	EXPECT_EQ(algorithm::decimal_shift_right(natural("987654321987654321"), 5).str(), "9876543219876");
+	EXPECT_EQ(algorithm::decimal_shift_right(natural("987654321987654321"), 18).str(), "0");
+	EXPECT_EQ(algorithm::decimal_shift_right(natural("987654321987654321"), 40).str(), "0");
+	EXPECT_EQ(algorithm::decimal_shift_right(integer(-450000000123), 10).str(), "-45");
+	EXPECT_EQ(algorithm::decimal_shift_right(integer(-45), 10).str(), "0");
+	EXPECT_EQ(algorithm::decimal_shift_right(rational(-3, 4u), 2).str(), "-3/400");
+
+	const natural num("48123749817263487162398476123987461293846391");
+	for (std::size_t n = 0; n < 30; ++n)
+	{
+		EXPECT_EQ(algorithm::decimal_shift(num, n), num * algorithm::pow(natural(10), n));
+		EXPECT_EQ(algorithm::decimal_shift_right(algorithm::decimal_shift(num, n), n), num);
+	}
+}
+
+TEST(AlgorithmTestSuite, TestPowerCache)
+{
+	using namespace big;
+
+	algorithm::power_cache cache;
+
+	EXPECT_EQ(*cache.square(3, 0), natural(3));
+	EXPECT_EQ(*cache.square(3, 3), natural(6561));
+	EXPECT_EQ(cache.square(3, 3), cache.square(3, 3));
+	EXPECT_EQ(cache.power(3, natural(13)), natural(1594323));
+	EXPECT_EQ(cache.power(7, natural(0)), natural(1));
+	EXPECT_EQ(cache.power(1, natural(100)), natural(1));
+	EXPECT_EQ(cache.power(0, natural(100)), natural(0));
+
+	cache.warm_up(10, 6);
+	EXPECT_EQ(*cache.square(10, 6), algorithm::decimal_shift(natural(1), 64));
+	EXPECT_GT(cache.size(), 0u);
+
+	cache.clear();
+	EXPECT_EQ(cache.size(), 0u);
+
+	cache.set_limit(4);
+	EXPECT_EQ(*cache.square(10, 6), algorithm::decimal_shift(natural(1), 64));
+	EXPECT_LE(cache.size(), 4u);
+
+	EXPECT_THROW(static_cast<void>(cache.square(2, algorithm::power_cache::max_levels)), std::out_of_range);
+
+	for (natural::digit_type base = 2; base < 2 + 2 * algorithm::power_cache::max_bases; ++base)
+	{
+		EXPECT_EQ(cache.power(base, natural(5)), natural(base) * base * base * base * base);
+	}
+
+	// every table is claimed, so the squares of a new base are not stored until the cache is cleared
+	cache.set_limit(algorithm::power_cache::default_limit);
+	const auto size = cache.size();
+	EXPECT_EQ(*cache.square(999'999'937, 2), algorithm::pow(natural(999'999'937), 4));
+	EXPECT_EQ(cache.size(), size);
+
+	const auto held = cache.square(3, 4);
+	cache.clear();
+	EXPECT_EQ(cache.size(), 0u);
+	EXPECT_EQ(*held, natural(43046721));
+
+	EXPECT_EQ(*cache.square(999'999'937, 2), algorithm::pow(natural(999'999'937), 4));
+	EXPECT_GT(cache.size(), 0u);
+
+	// the general power does not claim tables of the global cache
+	const auto global_size = algorithm::power_cache::global().size();
+	EXPECT_EQ(algorithm::pow(natural(999'999'999), 3), natural(999'999'999) * 999'999'999 * 999'999'999);
+	EXPECT_EQ(algorithm::power_cache::global().size(), global_size);
+}
+
+TEST(AlgorithmTestSuite, TestRoots)
+{
+	using namespace big;
+
+	EXPECT_EQ(algorithm::isqrt(natural(0)), natural(0));
+	EXPECT_EQ(algorithm::isqrt(natural(1)), natural(1));
+	EXPECT_EQ(algorithm::isqrt(natural(99)), natural(9));
+	EXPECT_EQ(algorithm::isqrt(natural(100)), natural(10));
+	EXPECT_EQ(algorithm::isqrt(natural("999999999999999999")), natural(999999999));
+	EXPECT_EQ(algorithm::isqrt(natural("48123749817263487162398476123987461293846391")), natural("6937128355253597811463"));
+
+	{
+		const natural root("714263874612318723648172364871236487123648712364");
+		const natural square = root * root;
+
+		EXPECT_EQ(algorithm::isqrt(square), root);
+		EXPECT_EQ(algorithm::isqrt(square - 1), root - 1);
+		EXPECT_EQ(algorithm::isqrt(square + root + root), root);
+
+		const auto [s, r] = algorithm::sqrtrem(square + root);
+		EXPECT_EQ(s, root);
+		EXPECT_EQ(r, root);
+
+		const natural cube = square * root;
+		EXPECT_EQ(algorithm::iroot(cube, 3), root);
+		EXPECT_EQ(algorithm::iroot(cube - 1, 3), root - 1);
+		EXPECT_EQ(algorithm::iroot(cube, 1), cube);
+		EXPECT_EQ(algorithm::iroot(cube, 1000), natural(1));
+	}
+
+	EXPECT_EQ(algorithm::iroot(algorithm::pow(natural(12345), 17), 17), natural(12345));
+	EXPECT_EQ(algorithm::iroot(algorithm::pow(natural(12345), 17) - 1, 17), natural(12344));
+	EXPECT_EQ(algorithm::iroot(natural("18446744073709551615"), 64), natural(1));
+	EXPECT_EQ(algorithm::iroot(natural("18446744073709551616"), 64), natural(2));
+
+	// roots of large degrees are seeded close to the root, not by the whole limbs
+	for (const std::size_t k : {200u, 500u, 1000u})
+	{
+		const auto power = algorithm::pow(natural(3), k);
+		EXPECT_EQ(algorithm::iroot(power, k), natural(3));
+		EXPECT_EQ(algorithm::iroot(power - 1, k), natural(2));
+		EXPECT_TRUE(algorithm::is_perfect_power(power));
+	}
+
+	const natural large_root("123456789012345678901234567890123");
+	EXPECT_EQ(algorithm::iroot(algorithm::pow(large_root, 150), 150), large_root);
+	EXPECT_EQ(algorithm::iroot(algorithm::pow(large_root, 150) - 1, 150), large_root - 1);
+
+	EXPECT_EQ(algorithm::isqrt(integer(80)), integer(8));
+	EXPECT_EQ(algorithm::iroot(integer(-28), 3), integer(-3));
+	EXPECT_EQ(algorithm::sqrtrem(integer(80)).second, integer(16));
+
+	EXPECT_THROW(static_cast<void>(algorithm::isqrt(integer(-4))), std::domain_error);
+	EXPECT_THROW(static_cast<void>(algorithm::iroot(natural(4), 0)), std::domain_error);
+}
+
+TEST(AlgorithmTestSuite, TestPerfectPowers)
+{
+	using namespace big;
+
+	for (std::size_t i = 0; i < 2000; ++i)
+	{
+		const auto root = static_cast<std::size_t>(std::sqrt(i));
+		EXPECT_EQ(algorithm::is_perfect_square(natural(i)), root * root == i) << i;
+	}
+
+	{
+		const natural root("714263874612318723648172364871236487123648712364");
+
+		EXPECT_TRUE(algorithm::is_perfect_square(root * root));
+		EXPECT_FALSE(algorithm::is_perfect_square(root * root + 1));
+		EXPECT_FALSE(algorithm::is_perfect_square(root * root - 1));
+		EXPECT_TRUE(algorithm::is_perfect_power(root * root * root, 3));
+		EXPECT_FALSE(algorithm::is_perfect_power(root * root * root + 2, 3));
+		EXPECT_TRUE(algorithm::is_perfect_power(root * root * root));
+		EXPECT_FALSE(algorithm::is_perfect_power(root * root * root + 2));
+	}
+
+	EXPECT_TRUE(algorithm::is_perfect_power(algorithm::pow(natural(3), 101)));
+	EXPECT_TRUE(algorithm::is_perfect_power(algorithm::pow(natural(6), 35), 7));
+	EXPECT_FALSE(algorithm::is_perfect_power(algorithm::pow(natural(6), 35), 3));
+	EXPECT_FALSE(algorithm::is_perfect_power(algorithm::pow(natural(6), 35) * 2));
+	EXPECT_TRUE(algorithm::is_perfect_power(natural(0)));
+	EXPECT_TRUE(algorithm::is_perfect_power(natural(1)));
+	EXPECT_FALSE(algorithm::is_perfect_power(natural(2)));
+	EXPECT_FALSE(algorithm::is_perfect_power(natural(72)));
+
+	EXPECT_FALSE(algorithm::is_perfect_square(integer(-4)));
+	EXPECT_TRUE(algorithm::is_perfect_power(integer(-27)));
+	EXPECT_FALSE(algorithm::is_perfect_power(integer(-4)));
+	EXPECT_TRUE(algorithm::is_perfect_power(integer(-32), 5));
+	EXPECT_FALSE(algorithm::is_perfect_power(integer(-16), 4));
+
+	EXPECT_THROW(static_cast<void>(algorithm::is_perfect_power(natural(4), 0)), std::domain_error);
+}
+
+TEST(AlgorithmTestSuite, TestPrimality)
+{
+	using namespace big;
+
+	for (std::uintmax_t i = 0; i < 3000; ++i)
+	{
+		EXPECT_EQ(algorithm::is_probable_prime(natural(i)), algorithm::is_small_prime(i)) << i;
+	}
+
+	const natural p1("75468248741059190200826018020469156929767101332549");
+	const natural p2("23769913699489545445914955361415940963508618271313");
+	const natural p3("990755180010510460167100887481090445998503858555159987917995026659110657966871462428816478563970969777298865900091663501");
+
+	EXPECT_TRUE(algorithm::is_probable_prime(p1));
+	EXPECT_TRUE(algorithm::is_probable_prime(p2));
+	EXPECT_TRUE(algorithm::is_probable_prime(p3));
+	EXPECT_TRUE(algorithm::is_probable_prime(natural("170141183460469231731687303715884105727")));
+	EXPECT_TRUE(algorithm::is_probable_prime(algorithm::decimal_shift(natural(1), 100) + 267));
+	EXPECT_TRUE(algorithm::is_probable_prime(integer(p1)));
+
+	EXPECT_FALSE(algorithm::is_probable_prime(p1 * p2));
+	EXPECT_FALSE(algorithm::is_probable_prime(p3 * p3));
+	EXPECT_FALSE(algorithm::is_probable_prime(algorithm::decimal_shift(natural(1), 100) + 1));
+	EXPECT_FALSE(algorithm::is_probable_prime(natural("170141183460469231731687303715884105725")));
+	EXPECT_FALSE(algorithm::is_probable_prime(-integer(p1)));
+
+	// strong pseudoprimes to base 2 and strong Lucas pseudoprimes
+	EXPECT_TRUE(algorithm::is_strong_probable_prime(natural(2047), 2));
+	EXPECT_TRUE(algorithm::is_strong_probable_prime(natural(3215031751u), 2));
+	EXPECT_FALSE(algorithm::is_probable_prime(natural(3215031751u)));
+	EXPECT_TRUE(algorithm::is_strong_lucas_probable_prime(natural(5459)));
+	EXPECT_TRUE(algorithm::is_strong_lucas_probable_prime(natural(5777)));
+	EXPECT_FALSE(algorithm::is_strong_probable_prime(natural(5459), 2));
+	EXPECT_FALSE(algorithm::is_strong_lucas_probable_prime(natural(2047)));
+	EXPECT_TRUE(algorithm::is_strong_lucas_probable_prime(p1));
+
+	const std::vector<natural> candidates{p1, p1 * p2, p2, natural(561), natural(1000003), p3};
+	EXPECT_EQ(algorithm::batch_is_probable_prime(candidates, execution::policy::with_threads(3)), std::vector<bool>({true, false, true, false, true, true}));
+	EXPECT_TRUE(algorithm::batch_is_probable_prime({}).empty());
+}
+
+TEST(AlgorithmTestSuite, TestCombinatorics)
+{
+	using namespace big;
+
+	{
+		natural expected(1);
+		for (std::size_t i = 0; i < 60; ++i)
+		{
+			if (i > 0)
+			{
+				expected *= i;
+			}
+
+			EXPECT_EQ(algorithm::factorial(i), expected) << i;
+		}
+	}
+
+	EXPECT_EQ(algorithm::factorial(100).str(), "93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000");
+	EXPECT_EQ(algorithm::factorial(1000) % natural(1000000007), natural(641419708));
+
+	EXPECT_EQ(algorithm::binomial(0, 0), natural(1));
+	EXPECT_EQ(algorithm::binomial(5, 6), natural(0));
+	EXPECT_EQ(algorithm::binomial(10, 3), natural(120));
+	EXPECT_EQ(algorithm::binomial(100, 50).str(), "100891344545564193334812497256");
+	EXPECT_EQ(algorithm::binomial(1000, 333) % natural(1000000007), natural(670445816));
+
+	for (std::size_t n = 0; n < 30; ++n)
+	{
+		for (std::size_t k = 0; k <= n; ++k)
+		{
+			EXPECT_EQ(algorithm::binomial(n, k), algorithm::factorial(n) / (algorithm::factorial(k) * algorithm::factorial(n - k)));
+		}
+	}
+
+	EXPECT_EQ(algorithm::multinomial(std::vector<std::size_t>{3, 4, 5}), natural(27720));
+	EXPECT_EQ(algorithm::multinomial(std::vector<std::size_t>{30, 70}), algorithm::binomial(100, 30));
+	EXPECT_EQ(algorithm::multinomial(std::vector<std::size_t>{}), natural(1));
+}
+
+TEST(AlgorithmTestSuite, TestReductions)
+{
+	using namespace big;
+
+	{
+		std::vector<natural> values;
+		natural expected_product(1);
+		natural expected_sum(0);
+
+		for (std::size_t i = 1; i <= 200; ++i)
+		{
+			values.push_back(algorithm::pow(natural(i), i % 7));
+			expected_product *= values.back();
+			expected_sum += values.back();
+		}
+
+		EXPECT_EQ(algorithm::product(values), expected_product);
+		EXPECT_EQ(algorithm::product(values, execution::policy::with_threads(4)), expected_product);
+		EXPECT_EQ(algorithm::sum(values), expected_sum);
+		EXPECT_EQ(algorithm::sum(values, execution::policy::with_threads(3)), expected_sum);
+	}
+
+	EXPECT_EQ(algorithm::product(std::vector<natural>{}), natural(1));
+	EXPECT_EQ(algorithm::sum(std::vector<natural>{}), natural(0));
+	EXPECT_EQ(algorithm::product(std::vector<integer>{-2, 3, -5, -7}), integer(-210));
+	EXPECT_EQ(algorithm::sum(std::vector<integer>{-2, 3, -5, -7}), integer(-11));
+
+	{
+		std::vector<rational> harmonic;
+		rational expected{};
+
+		for (std::size_t i = 1; i <= 30; ++i)
+		{
+			harmonic.emplace_back(1, i);
+			expected += harmonic.back();
+		}
+
+		EXPECT_EQ(algorithm::sum(harmonic), expected);
+		EXPECT_EQ(algorithm::sum(harmonic, execution::policy::with_threads(4)).str(), expected.str());
+		EXPECT_EQ(algorithm::product(harmonic, execution::seq).str(), rational(natural(1), algorithm::factorial(30)).str());
+	}
+
+	EXPECT_EQ(algorithm::product(std::vector<rational>{rational(-2, 3u), rational(9, 4u)}).str(), "-3/2");
+	EXPECT_EQ(algorithm::sum(std::vector<rational>{rational(1, 6u), rational(1, 3u)}).str(), "1/2");
+	EXPECT_EQ(algorithm::product(std::vector<polynomial>{polynomial(std::vector<rational>{1, 1}), polynomial(std::vector<rational>{1, -1})}).str(), "x^2-1");
+}
+
+TEST(AlgorithmTestSuite, TestReductionGrain)
+{
+	using namespace big;
+
+	const auto policy = execution::policy::with_threads(4);
+	const auto caller = std::this_thread::get_id();
+	std::atomic<bool> forked = false;
+
+	const auto multiply = [&](natural a, const natural &b)
+	{
+		forked = forked || std::this_thread::get_id() != caller;
+		a *= b;
+		return a;
+	};
+
+	std::vector<natural> values;
+	for (std::size_t i = 2; i < 100; ++i)
+	{
+		values.emplace_back(i);
+	}
+
+	// a hundred single limbs are multiplied on the calling thread
+	EXPECT_EQ(algorithm::detail::reduce_tree(values, multiply, natural(1), policy, algorithm::parallel_product_threshold), algorithm::factorial(99));
+	EXPECT_FALSE(forked);
+
+	EXPECT_EQ(algorithm::detail::limb_count(natural(natural::digits_type(5, 1))), 5);
+	EXPECT_EQ(algorithm::detail::limb_count(-integer(natural(natural::digits_type(3, 1)))), 3);
+	EXPECT_EQ(algorithm::detail::limb_count(rational(natural(natural::digits_type(3, 1)), natural(natural::digits_type(2, 1)))), 5);
+	EXPECT_EQ(algorithm::detail::limb_count(polynomial(std::vector<rational>{1, 2, 3})), 6);
+
+	std::vector<natural> large;
+	natural expected(1);
+	for (std::size_t i = 0; i < 8; ++i)
+	{
+		large.push_back(algorithm::pow(natural(i + 2), 5000));
+		expected *= large.back();
+	}
+
+	EXPECT_EQ(algorithm::detail::reduce_tree(large, multiply, natural(1), policy, algorithm::parallel_product_threshold), expected);
+	EXPECT_EQ(algorithm::product(large, policy), expected);
+}
+
+TEST(AlgorithmTestSuite, TestRemainderTree)
+{
+	using namespace big;
+
+	const natural value = algorithm::factorial(300) + 12345;
+
+	std::vector<natural> moduli;
+	for (std::size_t i = 1; i <= 57; ++i)
+	{
+		moduli.push_back(algorithm::pow(natural(i), 5) + 1000000007);
+	}
+
+	const auto remainders = algorithm::remainder_tree(value, moduli);
+	ASSERT_EQ(remainders.size(), moduli.size());
+
+	for (std::size_t i = 0; i < moduli.size(); ++i)
+	{
+		EXPECT_EQ(remainders[i], value % moduli[i]);
+	}
+
+	EXPECT_TRUE(algorithm::remainder_tree(value, {}).empty());
+	EXPECT_EQ(algorithm::remainder_tree(natural(17), std::vector<natural>{natural(5)}), std::vector<natural>{natural(2)});
+	EXPECT_EQ(algorithm::product_tree(moduli).back().front(), algorithm::product(moduli));
+}
+
+TEST(AlgorithmTestSuite, TestBatchGcd)
+{
+	using namespace big;
+
+	const natural p1("75468248741059190200826018020469156929767101332549");
+	const natural p2("23769913699489545445914955361415940963508618271313");
+	const natural p3("1000000007");
+	const natural p4("998244353");
+	const natural p5("170141183460469231731687303715884105727");
+
+	const std::vector<natural> values{p1 * p2, p3 * p4, p2 * p5, p4 * p4, natural(35), natural(1)};
+	const std::vector<natural> expected{p2, p4, p2, p4, natural(1), natural(1)};
+
+	EXPECT_EQ(algorithm::batch_gcd(values), expected);
+	EXPECT_EQ(algorithm::batch_gcd(std::vector<natural>{natural(6)}), std::vector<natural>{natural(1)});
+	EXPECT_TRUE(algorithm::batch_gcd({}).empty());
+}
+
+TEST(AlgorithmTestSuite, TestExecutionPolicies)
+{
+	using namespace big;
+
+	const auto policy = execution::policy::with_threads(3);
+
+	EXPECT_EQ(algorithm::pow(natural(3), 5000, policy), algorithm::pow(natural(3), 5000));
+	EXPECT_EQ(algorithm::pow(natural("123456789123456789"), 700, execution::seq), algorithm::pow(natural("123456789123456789"), 700));
+	EXPECT_EQ(algorithm::pow(integer(-7), 3, policy), integer(-343));
+
+	const polynomial p(std::vector<rational>{1, 1});
+	EXPECT_EQ(algorithm::pow(p, 3, policy).str(), "x^3+3*x^2+3*x+1");
+
+	const natural a = algorithm::factorial(500);
+	const natural b = algorithm::pow(natural(2), 1000) * natural(3);
+	EXPECT_EQ(algorithm::gcd(a, b, policy), algorithm::gcd(a, b));
+	EXPECT_EQ(algorithm::gcd(integer(-12), integer(18), policy), algorithm::gcd(integer(-12), integer(18)));
+	EXPECT_EQ(algorithm::gcd(p * p, p, policy).str(), algorithm::gcd(p * p, p).str());
+}
+
 TEST(AlgorithmTestSuite, PolynomialGcd)
 {
 	using namespace big;
@@ -198,3 +647,127 @@ TEST(AlgorithmTestSuite, TestPowerBigNum)
 	std::cout << elapsed_seconds.count() << std::endl;
 	//std::cout << num << std::endl;
 }
+
+TEST(AlgorithmTestSuite, TestSort)
+{
+	using namespace big;
+
+	{
+		std::vector<natural> values = {
+			natural("1000000000000000000"), natural(7u), natural(0u), natural("999999999999999999"),
+			natural("1000000000000000001"), natural(7u), natural("5000000000"), natural("4000000001")
+		};
+
+		auto expected = values;
+		std::ranges::sort(expected);
+
+		EXPECT_EQ(algorithm::sort(values), values.end());
+		EXPECT_EQ(values, expected);
+
+		const auto rest = algorithm::unique(values);
+		values.erase(rest.begin(), rest.end());
+		EXPECT_EQ(std::ranges::size(values), 7);
+		EXPECT_TRUE(std::ranges::is_sorted(values) && std::ranges::adjacent_find(values) == values.end());
+	}
+	{
+		std::mt19937 gen(47);
+		std::vector<natural> values;
+		for (int i = 0; i < 1000; ++i)
+		{
+			// few distinct lengths and top limbs, so that the keys often tie
+			natural::digits_type digits(1 + gen() % 3);
+			for (auto &digit : digits)
+			{
+				digit = gen() % 4;
+			}
+			digits.back() += 1;
+			values.emplace_back(std::move(digits));
+		}
+
+		auto expected = values;
+		std::ranges::sort(expected);
+		expected.erase(std::ranges::unique(expected).begin(), expected.end());
+
+		const auto order = algorithm::sort_permutation(values);
+		EXPECT_TRUE(std::ranges::is_sorted(order, {}, [&](std::size_t i) -> const natural & { return values[i]; }));
+
+		algorithm::sort(values);
+		values.erase(algorithm::unique(values).begin(), values.end());
+		EXPECT_EQ(values, expected);
+	}
+	{
+		std::vector<natural> empty;
+		EXPECT_EQ(algorithm::sort(empty), empty.end());
+		EXPECT_TRUE(std::ranges::empty(algorithm::unique(empty)));
+	}
+}
+
+TEST(AlgorithmTestSuite, TestHash)
+{
+	using namespace big;
+
+	const natural big_value("123456789012345678901234567890");
+	EXPECT_EQ(std::hash<natural>{}(big_value), std::hash<natural>{}(natural("123456789012345678901234567890")));
+	EXPECT_EQ(std::hash<natural>{}(big_value), std::hash<natural_view>{}(big_value.view()));
+	EXPECT_NE(std::hash<natural>{}(natural(1u)), std::hash<natural>{}(natural(1'000'000'000u)));
+
+	EXPECT_NE(std::hash<integer>{}(integer(5)), std::hash<integer>{}(integer(-5)));
+	EXPECT_EQ(std::hash<integer>{}(integer(0)), std::hash<integer>{}(-integer(0)));
+	EXPECT_EQ(std::hash<rational>{}(rational(2, 4u)), std::hash<rational>{}(rational(1, 2u)));
+	EXPECT_NE(std::hash<rational>{}(rational(1, 2u)), std::hash<rational>{}(rational(2, 1u)));
+
+	std::unordered_set<natural> naturals;
+	for (unsigned i = 0; i < 1000; ++i)
+	{
+		naturals.insert(natural(i % 100) * big_value);
+	}
+	EXPECT_EQ(std::ranges::size(naturals), 100);
+
+	std::unordered_set<polynomial> polynomials = {polynomial({1, 2, 3}), polynomial({1, 2, 3}), polynomial({3, 2, 1})};
+	EXPECT_EQ(std::ranges::size(polynomials), 2);
+	EXPECT_TRUE(polynomials.contains(polynomial({3, 2, 1})));
+	EXPECT_FALSE(polynomials.contains(polynomial({1, 1, 1})));
+
+	// polynomials of the same degree are equivalent without being equal
+	static_assert(std::same_as<std::compare_three_way_result_t<polynomial>, std::weak_ordering>);
+	EXPECT_TRUE(std::is_eq(polynomial({1, 2, 3}) <=> polynomial({3, 2, 1})));
+	EXPECT_NE(polynomial({1, 2, 3}), polynomial({3, 2, 1}));
+}
+
+namespace
+{
+template <typename T>
+concept has_isqrt = requires (const T &n)
+{
+	big::algorithm::isqrt(n);
+};
+
+template <typename T>
+concept has_perfect_power_check = requires (const T &n)
+{
+	big::algorithm::is_perfect_power(n);
+};
+
+template <typename T>
+concept has_primality_check = requires (const T &n)
+{
+	big::algorithm::is_probable_prime(n);
+};
+}
+
+TEST(AlgorithmTestSuite, TestFixedWidthInterface)
+{
+	using namespace big;
+
+	// the generic algorithms accept fixed-width numbers
+	EXPECT_EQ(algorithm::gcd(natural_fixed<4>(1'000'000u), natural_fixed<4>(640u)), natural_fixed<4>(320u));
+	EXPECT_EQ(algorithm::pow(integer_fixed<4>(-10), 20u), integer_fixed<4>(natural_fixed<4>(natural("100000000000000000000"))));
+	EXPECT_EQ(algorithm::lcm(natural_fixed<2>(6u), natural_fixed<2>(10u)), natural_fixed<2>(30u));
+
+	// the ones working on the limbs of natural reject them at the interface
+	static_assert(has_isqrt<natural> && has_isqrt<integer>);
+	static_assert(!has_isqrt<natural_fixed<4>> && !has_isqrt<integer_fixed<4>>);
+	static_assert(has_perfect_power_check<natural> && !has_perfect_power_check<natural_fixed<4>>);
+	static_assert(has_primality_check<integer> && has_primality_check<int>);
+	static_assert(!has_primality_check<natural_fixed<4>> && !has_primality_check<integer_fixed<4>>);
+}
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include "../big/execution/execution.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+std::uint64_t parallel_sum(big::execution::thread_pool &pool, const std::vector<std::uint64_t> &values, std::size_t begin, std::size_t end)
+{
+	if (end - begin <= 64)
+	{
+		return std::accumulate(values.begin() + begin, values.begin() + end, std::uint64_t{0});
+	}
+
+	const auto middle = begin + (end - begin) / 2;
+	std::uint64_t left = 0;
+
+	big::execution::task_group group(pool);
+	group.run([&] { left = parallel_sum(pool, values, begin, middle); });
+
+	const auto right = parallel_sum(pool, values, middle, end);
+	group.wait();
+
+	return left + right;
+}
+}
+
+TEST(ExecutionTestSuite, TestNestedForks)
+{
+	using namespace big;
+
+	std::vector<std::uint64_t> values(100000);
+	std::iota(values.begin(), values.end(), 1);
+
+	for (const std::size_t threads : {0, 1, 4})
+	{
+		execution::thread_pool pool(threads);
+
+		ASSERT_EQ(pool.concurrency(), threads + 1);
+		ASSERT_EQ(parallel_sum(pool, values, 0, values.size()), 5000050000u);
+	}
+}
+
+TEST(ExecutionTestSuite, TestExceptions)
+{
+	using namespace big;
+
+	execution::thread_pool pool(2);
+	execution::task_group group(pool);
+
+	std::atomic<int> completed{0};
+
+	group.run([&] { ++completed; });
+	group.run([] { throw std::runtime_error("task failure"); });
+	group.run([&] { ++completed; });
+
+	ASSERT_THROW(group.wait(), std::runtime_error);
+	ASSERT_EQ(completed, 2);
+
+	group.run([&] { ++completed; });
+	ASSERT_NO_THROW(group.wait());
+	ASSERT_EQ(completed, 3);
+}
+
+TEST(ExecutionTestSuite, TestGlobalPool)
+{
+	using namespace big;
+
+	execution::thread_pool::set_global_threads(3);
+	ASSERT_EQ(execution::thread_pool::global()->concurrency(), 4);
+
+	execution::thread_pool::set_global_threads(std::thread::hardware_concurrency());
+	ASSERT_EQ(execution::thread_pool::global()->concurrency(), std::thread::hardware_concurrency() + 1);
+}
+
+TEST(ExecutionTestSuite, TestDefaultPolicy)
+{
+	using namespace big;
+
+	ASSERT_TRUE(execution::par.is_parallel());
+	ASSERT_FALSE(execution::seq.is_parallel());
+	ASSERT_EQ(execution::seq.concurrency(), 1);
+	ASSERT_EQ(execution::policy::with_threads(3).concurrency(), 3);
+	ASSERT_EQ(execution::policy::with_threads(1).concurrency(), 1);
+
+	ASSERT_TRUE(execution::default_policy().is_parallel());
+
+	{
+		execution::scoped_policy outer(execution::seq);
+		ASSERT_FALSE(execution::default_policy().is_parallel());
+
+		{
+			execution::scoped_policy inner(execution::policy::with_threads(2));
+			ASSERT_EQ(execution::default_policy().concurrency(), 2);
+		}
+
+		ASSERT_FALSE(execution::default_policy().is_parallel());
+	}
+
+	execution::set_default_policy(execution::seq);
+	ASSERT_FALSE(execution::default_policy().is_parallel());
+
+	execution::set_default_policy(execution::par);
+	ASSERT_TRUE(execution::default_policy().is_parallel());
+}
+
+TEST(ExecutionTestSuite, TestParallelFor)
+{
+	using namespace big;
+
+	const auto policy = execution::policy::with_threads(4);
+
+	std::vector<int> visited(1000);
+	std::atomic<int> chunks{0};
+
+	execution::parallel_for(policy, visited.size(), 100, [&](std::size_t begin, std::size_t end)
+	{
+		++chunks;
+		ASSERT_EQ(execution::default_policy().concurrency(), 4);
+
+		for (auto i = begin; i < end; ++i)
+		{
+			++visited[i];
+		}
+	});
+
+	ASSERT_EQ(chunks, 4);
+	ASSERT_TRUE(std::ranges::all_of(visited, [](int count) { return count == 1; }));
+
+	execution::parallel_for(policy, 10, 100, [&](std::size_t begin, std::size_t end)
+	{
+		ASSERT_EQ(begin, 0);
+		ASSERT_EQ(end, 10);
+	});
+
+	ASSERT_THROW(execution::parallel_for(policy, 8, 1, [](std::size_t begin, std::size_t) { if (begin != 0) throw std::runtime_error("chunk failure"); }), std::runtime_error);
+}
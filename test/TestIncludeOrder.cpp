@@ -0,0 +1,33 @@
+// the literals are included first on purpose: their inline namespace must not
+// make the `detail` namespaces of the headers that follow ambiguous
+#include "../big/parse/literals.hpp"
+#include "../big/natural/limb_batch.hpp"
+#include "../big/natural/natural_array.hpp"
+#include "../big/natural/shared_natural.hpp"
+#include "../big/natural/natural_fixed.hpp"
+#include "../big/integer/integer_fixed.hpp"
+#include "../big/polynomial/polynomial.hpp"
+#include "../big/algorithm/algorithm.hpp"
+#include "../big/algorithm/combinatorics.hpp"
+#include "../big/algorithm/perfect_power.hpp"
+#include "../big/algorithm/prime.hpp"
+#include "../big/algorithm/reduce.hpp"
+#include "../big/algorithm/remainder_tree.hpp"
+#include "../big/algorithm/root.hpp"
+#include "../big/algorithm/sort.hpp"
+#include "../big/conv/binary.hpp"
+#include "../big/conv/decimal.hpp"
+#include "../big/conv/mapped_table.hpp"
+#include "../big/parse/bulk.hpp"
+#include "gtest/gtest.h"
+
+TEST(IncludeOrderTestSuite, TestLiteralsFirst)
+{
+	using namespace big;
+
+	const limb_batch<2> batch(std::vector{123456789012345678_n, 5_n});
+	EXPECT_EQ(batch_mod(batch, limb_batch<1>(std::vector{7_n, 3_n}))[0], 123456789012345678_n % 7_n);
+	EXPECT_EQ(std::hash<polynomial>{}(polynomial({1, 2, 3})), std::hash<polynomial>{}(polynomial({1, 2, 3})));
+	EXPECT_EQ(algorithm::decimal_shift(12_n, 10), 120000000000_n);
+	EXPECT_EQ("-6/4"_q, rational(-3, 2u));
+}
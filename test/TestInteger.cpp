@@ -1,5 +1,8 @@
 #include "../big/integer/integer.hpp"
+#include "../big/integer/integer_fixed.hpp"
 #include "../big/rational/rational.hpp"
+#include "../big/parse/literals.hpp"
+#include <sstream>
 #include "gtest/gtest.h"
 
 TEST(IntegerTestSuite, TestComparison)
@@ -199,3 +202,67 @@ TEST(IntegerTestSuite, TestModule)
 		EXPECT_EQ(e.what(), std::string("division by zero"));
 	}
 }
+
+TEST(IntegerTestSuite, TestStreamInput)
+{
+	using namespace big;
+
+	std::istringstream in("-123456789012345678901 +5 -0 7 - 8");
+	integer a, b, c, d, e(3);
+	in >> a >> b >> c >> d;
+	ASSERT_EQ(a, integer(natural("123456789012345678901"), true));
+	ASSERT_EQ(b, 5);
+	ASSERT_EQ(c, 0);
+	ASSERT_FALSE(c.sign_bit());
+	ASSERT_EQ(d, 7);
+	ASSERT_FALSE(in >> e);
+	ASSERT_EQ(e, 3);
+}
+
+TEST(IntegerTestSuite, TestLiterals)
+{
+	using namespace big;
+
+	static_assert(-5_z == integer(-5));
+	static_assert(-17_z / 5_z == integer(-3) && -17_z % 5_z == integer(-2));
+
+	EXPECT_EQ(-98765432109876543210_z, -integer(natural("98765432109876543210")));
+	EXPECT_EQ((123456789012345678901234567890_z * -1_z).str(), "-123456789012345678901234567890");
+}
+
+TEST(IntegerTestSuite, TestFixedWidth)
+{
+	using namespace big;
+	using fixed = integer_fixed<3>;
+
+	static_assert(fixed(-17) / fixed(5) == fixed(-3));
+	static_assert(fixed(-17) % fixed(5) == fixed(-2));
+	static_assert(fixed(17) % fixed(-5) == fixed(2));
+	static_assert(fixed(-3) * fixed(-4) == fixed(12));
+	static_assert(fixed(-5) < fixed(3));
+	static_assert(fixed(-5) < fixed(-3));
+	static_assert(-fixed(0) == fixed(0));
+	static_assert(algorithm::pow(fixed(-2), 61) == fixed(-2305843009213693952ll));
+	static_assert(algorithm::gcd(fixed(-48), fixed(180)).abs() == natural_fixed<3>(12u));
+
+	for (int a = -30; a <= 30; ++a)
+	{
+		for (int b = -30; b <= 30; ++b)
+		{
+			EXPECT_EQ(fixed(a) + fixed(b), fixed(a + b));
+			EXPECT_EQ(fixed(a) - fixed(b), fixed(a - b));
+			EXPECT_EQ(fixed(a) * fixed(b), fixed(a * b));
+			EXPECT_EQ(fixed(a) <=> fixed(b), a <=> b);
+
+			if (b != 0)
+			{
+				EXPECT_EQ(fixed(a) / fixed(b), fixed(a / b));
+				EXPECT_EQ(fixed(a) % fixed(b), fixed(a % b));
+			}
+		}
+	}
+
+	EXPECT_EQ(fixed(-1234567890123456789ll).str(), "-1234567890123456789");
+	EXPECT_EQ(algorithm::divexact(fixed(-1000000000000ll), fixed(1000)), fixed(-1000000000));
+	EXPECT_EQ(algorithm::decimal_shift_right(fixed(-123456), 3), fixed(-123));
+}
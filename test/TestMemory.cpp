@@ -0,0 +1,364 @@
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <optional>
+#include <thread>
+#include <memory_resource>
+#include "../big/memory/allocator.hpp"
+#include "../big/algorithm/reduce.hpp"
+#include "../big/natural/natural.hpp"
+#include "../big/parse/bulk.hpp"
+#include "../big/polynomial/polynomial.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+/**
+ * Resource that counts the bytes allocated from it.
+ */
+class counting_resource : public std::pmr::memory_resource
+{
+	std::pmr::memory_resource *upstream_;
+public:
+	std::size_t allocated = 0;
+	std::size_t deallocated = 0;
+
+	explicit counting_resource(std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) : upstream_(upstream)
+	{
+	}
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		allocated += bytes;
+		return upstream_->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+	{
+		deallocated += bytes;
+		upstream_->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+/**
+ * Resource that records whether a thread other than its creator used it.
+ */
+class owner_resource : public std::pmr::memory_resource
+{
+	std::pmr::memory_resource *upstream_;
+	std::thread::id owner_ = std::this_thread::get_id();
+public:
+	std::atomic<bool> shared = false;
+
+	explicit owner_resource(std::pmr::memory_resource *upstream) : upstream_(upstream)
+	{
+	}
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		if (std::this_thread::get_id() != owner_)
+		{
+			shared = true;
+		}
+
+		return upstream_->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+	{
+		if (std::this_thread::get_id() != owner_)
+		{
+			shared = true;
+		}
+
+		upstream_->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+}
+
+TEST(MemoryTestSuite, TestAlignment)
+{
+	using namespace big;
+
+	const natural number(natural::digits_type(1000, 1));
+	const auto address = reinterpret_cast<std::uintptr_t>(number.digits().data());
+
+	ASSERT_EQ(address % memory::storage_alignment, 0);
+}
+
+TEST(MemoryTestSuite, TestScopedResource)
+{
+	using namespace big;
+
+	counting_resource counter;
+	natural outside;
+
+	{
+		memory::scoped_resource scope(&counter);
+		ASSERT_EQ(memory::current_resource(), &counter);
+
+		natural a("123456789123456789123456789123456789");
+		a *= a;
+		a += natural(1u);
+
+		ASSERT_GT(counter.allocated, 0);
+		ASSERT_EQ(a.digits().get_allocator().resource(), &counter);
+
+		outside = a;
+	}
+
+	ASSERT_EQ(memory::current_resource(), memory::default_resource());
+	ASSERT_EQ(counter.allocated, counter.deallocated);
+	ASSERT_EQ(outside.str(), "15241578780673678546105778311537878046486820281054720515622620750190522");
+	ASSERT_NE(outside.digits().get_allocator().resource(), &counter);
+}
+
+TEST(MemoryTestSuite, TestMonotonicArena)
+{
+	using namespace big;
+
+	counting_resource upstream;
+	std::string result;
+
+	{
+		std::pmr::monotonic_buffer_resource arena(&upstream);
+		memory::scoped_resource scope(&arena);
+
+		polynomial p(std::vector<rational>{1, -2, 1});
+		p *= p;
+		p.normalize();
+
+		ASSERT_EQ(p.coefficients().get_allocator().resource(), &arena);
+		result = p.str();
+	}
+
+	ASSERT_EQ(result, "x^4-4*x^3+6*x^2-4*x+1");
+	ASSERT_GT(upstream.allocated, 0);
+	ASSERT_EQ(upstream.allocated, upstream.deallocated);
+}
+
+TEST(MemoryTestSuite, TestParallelArena)
+{
+	using namespace big;
+
+	const auto policy = execution::policy::with_threads(4);
+
+	natural::digits_type digits(4 * natural::parallel_mul_threshold + 5);
+	for (std::size_t i = 0; i < digits.size(); ++i)
+	{
+		digits[i] = static_cast<natural::digit_type>((i * 2654435761u + 12345) % natural::number_system_base);
+	}
+
+	const natural a(digits);
+	const natural b = a + natural(987654321u);
+	natural expected(a);
+	expected.multiply(b, execution::seq);
+
+	std::vector<rational> coefficients;
+	for (int i = 0; i < 3 * static_cast<int>(polynomial::parallel_threshold); ++i)
+	{
+		coefficients.emplace_back(i * i - 7, static_cast<unsigned>(i % 5 + 1));
+	}
+
+	const polynomial p(coefficients);
+	polynomial expected_square(p);
+	expected_square.multiply(p, execution::seq);
+
+	std::vector<natural> factors;
+	for (std::size_t i = 0; i < 8; ++i)
+	{
+		factors.push_back(a + natural(i));
+	}
+
+	const auto expected_factors = algorithm::product(factors, execution::seq);
+
+	std::string text;
+	for (std::size_t i = 0; std::ranges::size(text) < 3 * parse::detail::min_bulk_chunk; ++i)
+	{
+		text += std::to_string(i * 7919) + "\n";
+	}
+
+	counting_resource upstream;
+
+	{
+		std::pmr::monotonic_buffer_resource arena(&upstream);
+		owner_resource owner(&arena);
+		memory::scoped_resource scope(&owner);
+
+		// the arena is not thread-safe, so the work forked from this thread must allocate elsewhere
+		natural product(a);
+		product.multiply(b, policy);
+		EXPECT_EQ(product, expected);
+		EXPECT_EQ(product.digits().get_allocator().resource(), &owner);
+
+		polynomial square(p);
+		square.multiply(p, policy);
+		EXPECT_EQ(square, expected_square);
+
+		const auto [quotient, remainder] = square.long_div(p, policy);
+		EXPECT_EQ(quotient, p);
+		EXPECT_TRUE(remainder.is_zero());
+
+		EXPECT_EQ(algorithm::product(factors, policy), expected_factors);
+
+		const parse::bulk_numbers<natural> numbers(text, ',', policy);
+		EXPECT_EQ(numbers[numbers.size() - 1], natural((numbers.size() - 1) * 7919));
+
+		EXPECT_FALSE(owner.shared);
+	}
+
+	EXPECT_EQ(upstream.allocated, upstream.deallocated);
+}
+
+TEST(MemoryTestSuite, TestLimbPool)
+{
+	using namespace big;
+
+	counting_resource upstream;
+
+	{
+		memory::limb_pool_resource pool(&upstream);
+		memory::scoped_resource scope(&pool);
+
+		const natural a("987654321987654321987654321987654321987654321");
+
+		for (int i = 0; i < 100; ++i)
+		{
+			natural b = a * a;
+			b += a;
+			ASSERT_EQ(b % a, natural(0u));
+		}
+
+		const auto stats = pool.thread_statistics();
+		EXPECT_GT(stats.hits, 0);
+		EXPECT_GT(stats.recycled, 0);
+		EXPECT_GT(stats.hits, 10 * stats.misses);
+		EXPECT_LE(stats.cached_bytes, pool.max_bytes());
+
+		const auto allocated = upstream.allocated;
+		{
+			natural c = a * a;
+		}
+		EXPECT_EQ(upstream.allocated, allocated);
+
+		pool.release_thread_cache();
+		EXPECT_EQ(pool.thread_statistics().cached_bytes, 0);
+	}
+
+	EXPECT_EQ(upstream.allocated, upstream.deallocated);
+}
+
+TEST(MemoryTestSuite, TestLimbPoolCaps)
+{
+	using namespace big;
+
+	counting_resource upstream;
+	memory::limb_pool_resource pool(&upstream);
+
+	pool.set_max_blocks(2);
+	ASSERT_EQ(pool.max_blocks(), 2);
+
+	std::vector<void *> blocks;
+	for (int i = 0; i < 5; ++i)
+	{
+		blocks.push_back(pool.allocate(100, 8));
+	}
+
+	for (auto *block : blocks)
+	{
+		pool.deallocate(block, 100, 8);
+	}
+
+	auto stats = pool.thread_statistics();
+	EXPECT_EQ(stats.misses, 5);
+	EXPECT_EQ(stats.recycled, 2);
+	EXPECT_EQ(stats.released, 3);
+	EXPECT_EQ(stats.cached_bytes, 2 * 128);
+
+	auto *oversized = pool.allocate(memory::limb_pool_resource::max_block_size + 1, 8);
+	pool.deallocate(oversized, memory::limb_pool_resource::max_block_size + 1, 8);
+	EXPECT_EQ(pool.thread_statistics().oversized, 1);
+
+	pool.set_max_bytes(0);
+	auto *block = pool.allocate(64, 8);
+	auto *other = pool.allocate(64, 8);
+	pool.deallocate(block, 64, 8);
+	pool.deallocate(other, 64, 8);
+
+	stats = pool.thread_statistics();
+	EXPECT_EQ(stats.released, 5);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % memory::limb_pool_resource::block_alignment, 0);
+
+	pool.release_thread_cache();
+	EXPECT_EQ(upstream.allocated, upstream.deallocated);
+}
+
+TEST(MemoryTestSuite, TestLimbPoolReuse)
+{
+	using namespace big;
+
+	counting_resource first_upstream;
+	counting_resource second_upstream;
+	std::optional<memory::limb_pool_resource> pool(std::in_place, &first_upstream);
+
+	std::promise<void> first_done;
+	std::promise<void> replaced;
+	std::promise<memory::limb_pool_resource::statistics> second_done;
+
+	// the worker outlives the first resource, so its cache entry must not be taken for the second one at the same address
+	std::thread worker([&]
+	{
+		pool->deallocate(pool->allocate(100, 8), 100, 8);
+		pool->release_thread_cache();
+		first_done.set_value();
+
+		replaced.get_future().wait();
+		pool->deallocate(pool->allocate(100, 8), 100, 8);
+		const auto stats = pool->thread_statistics();
+		pool->release_thread_cache();
+		second_done.set_value(stats);
+	});
+
+	first_done.get_future().wait();
+	pool.reset();
+	pool.emplace(&second_upstream);
+	replaced.set_value();
+
+	const auto stats = second_done.get_future().get();
+	worker.join();
+
+	EXPECT_EQ(stats.misses, 1);
+	EXPECT_EQ(stats.recycled, 1);
+	EXPECT_EQ(first_upstream.allocated, first_upstream.deallocated);
+	EXPECT_EQ(second_upstream.allocated, second_upstream.deallocated);
+	EXPECT_GT(second_upstream.allocated, 0);
+}
+
+TEST(MemoryTestSuite, TestDefaultResource)
+{
+	using namespace big;
+
+	ASSERT_EQ(memory::default_resource(), &memory::limb_pool_resource::global());
+
+	counting_resource counter;
+	ASSERT_EQ(memory::set_default_resource(&counter), &memory::limb_pool_resource::global());
+
+	{
+		const natural a("123456789123456789123456789");
+		ASSERT_EQ(a.digits().get_allocator().resource(), &counter);
+	}
+
+	ASSERT_EQ(memory::set_default_resource(nullptr), &counter);
+	ASSERT_EQ(memory::default_resource(), &memory::limb_pool_resource::global());
+	ASSERT_EQ(counter.allocated, counter.deallocated);
+}
@@ -1,5 +1,14 @@
 #include "../big/natural/natural.hpp"
+#include "../big/natural/shared_natural.hpp"
+#include "../big/natural/natural_array.hpp"
+#include "../big/natural/limb_batch.hpp"
+#include "../big/natural/natural_fixed.hpp"
 #include "../big/algorithm/algorithm.hpp"
+#include <memory_resource>
+#include <random>
+#include <sstream>
+#include "../big/parse/decimal.hpp"
+#include "../big/parse/literals.hpp"
 #include "gtest/gtest.h"
 
 TEST(NaturalTestSuite, TestConstruction)
@@ -225,6 +234,70 @@ TEST(NaturalTestSuite, TestProduct)
 	ASSERT_EQ(a.str(), "8951028917198964712757504215998227867810191445839800441149608111417415741073044384885876111521");
 }
 
+TEST(NaturalTestSuite, TestParallelProduct)
+{
+	using namespace big;
+
+	natural::digits_type digits1(5000);
+	natural::digits_type digits2(4500);
+
+	std::uint64_t state = 12345;
+	for (auto *digits : {&digits1, &digits2})
+	{
+		for (auto &digit : *digits)
+		{
+			state = state * 6364136223846793005u + 1442695040888963407u;
+			digit = static_cast<natural::digit_type>((state >> 32) % natural::number_system_base);
+		}
+	}
+
+	const natural a(digits1);
+	const natural b(digits2);
+
+	execution::thread_pool::set_global_threads(0);
+	const natural sequential = a * b;
+
+	execution::thread_pool::set_global_threads(4);
+	const natural parallel = a * b;
+
+	execution::thread_pool::set_global_threads(std::thread::hardware_concurrency());
+
+	ASSERT_EQ(parallel, sequential);
+
+	const natural p("1000000000000000000000000000057");
+	ASSERT_EQ(parallel % p, (a % p) * (b % p) % p);
+
+	natural product(a);
+	product.multiply(b, execution::policy::with_threads(3));
+	ASSERT_EQ(product, sequential);
+
+	product = a;
+	product.multiply(b, execution::seq);
+	ASSERT_EQ(product, sequential);
+}
+
+TEST(NaturalTestSuite, TestPolicyDivision)
+{
+	using namespace big;
+
+	natural::digits_type digits(4099);
+	for (std::size_t i = 0; i < digits.size(); ++i)
+	{
+		digits[i] = static_cast<natural::digit_type>((i * 2654435761u + 12345) % natural::number_system_base);
+	}
+
+	const natural divisor(digits);
+	const natural quotient("123456789987654321123456789");
+	const natural remainder = divisor - natural(7);
+	const natural dividend = divisor * quotient + remainder;
+
+	const auto [q, r] = dividend.long_div(divisor, execution::policy::with_threads(4));
+	ASSERT_EQ(q, quotient);
+	ASSERT_EQ(r, remainder);
+
+	ASSERT_EQ(dividend.long_div(divisor, execution::seq), std::make_pair(quotient, remainder));
+}
+
 TEST(NaturalTestSuite, TestBitwiseLeftShift)
 {
 	using namespace big;
@@ -355,3 +428,427 @@ TEST(NaturalTestSuite, TestModule)
 
 	ASSERT_EQ(natural("42") % natural("6"), natural("0"));
 }
+
+TEST(NaturalTestSuite, TestSharedNatural)
+{
+	using namespace big;
+
+	// the shared zero outlives an arena that is current at its first use
+	{
+		std::pmr::monotonic_buffer_resource arena;
+		memory::scoped_resource scope(&arena);
+		const shared_natural first_zero;
+		ASSERT_EQ(first_zero->digits().get_allocator().resource(), std::pmr::new_delete_resource());
+	}
+
+	const shared_natural zero;
+	ASSERT_EQ(zero, natural(0u));
+	ASSERT_TRUE(zero.is_shared());
+
+	shared_natural a(natural("123456789123456789123456789"));
+	ASSERT_FALSE(a.is_shared());
+
+	shared_natural b = a;
+	ASSERT_TRUE(a.is_shared());
+	ASSERT_EQ(&a.get(), &b.get());
+
+	b += natural(1u);
+	ASSERT_FALSE(a.is_shared());
+	ASSERT_FALSE(b.is_shared());
+	ASSERT_NE(&a.get(), &b.get());
+	ASSERT_EQ(a.str(), "123456789123456789123456789");
+	ASSERT_EQ(b.str(), "123456789123456789123456790");
+	ASSERT_GT(b, a);
+
+	// mutating an unshared value does not duplicate the limbs
+	const auto *digits = b->digits().data();
+	b.mutate().mul_digit(2);
+	ASSERT_EQ(b->digits().data(), digits);
+	ASSERT_EQ(b, natural("246913578246913578246913580"));
+
+	shared_natural c = a;
+	c *= a;
+	c %= natural(1000000007u);
+	ASSERT_EQ(c, a.get() * a.get() % natural(1000000007u));
+	ASSERT_EQ(algorithm::gcd<natural>(a, c), algorithm::gcd(a.get(), c.get()));
+
+	shared_natural d = a;
+	const natural released = std::move(d).release();
+	ASSERT_EQ(released, a);
+	ASSERT_EQ(d, zero);
+
+	shared_natural e = natural(10u);
+	e <<= 1;
+	e >>= 1;
+	e -= natural(3u);
+	e /= natural(7u);
+	ASSERT_EQ(e, natural(1u));
+}
+
+TEST(NaturalTestSuite, TestNaturalView)
+{
+	using namespace big;
+
+	// views of external memory are normalized
+	const std::uint32_t limbs[] = {999999999, 123, 7, 0, 0};
+	const natural_view view(limbs);
+	ASSERT_EQ(view.size(), 3);
+	ASSERT_EQ(view, natural("7000000123999999999"));
+	ASSERT_TRUE(natural_view().is_zero());
+	ASSERT_TRUE(natural_view(std::span(limbs + 3, 2)).is_zero());
+	ASSERT_EQ(natural(view).str(), "7000000123999999999");
+
+	const std::uint32_t invalid[] = {1000000000};
+	ASSERT_THROW(natural_view{invalid}, std::invalid_argument);
+
+	// subviews select digits without copying
+	ASSERT_EQ(view.subview(1), natural("7000000123"));
+	ASSERT_EQ(view.subview(0, 1), natural("999999999"));
+	ASSERT_EQ(view.subview(1, 1).digits().data(), limbs + 1);
+	ASSERT_TRUE(view.subview(5).is_zero());
+
+	const std::uint32_t sparse[] = {5, 0, 0, 1};
+	ASSERT_EQ(natural_view(sparse).subview(0, 3).size(), 1);
+
+	// comparison
+	ASSERT_LT(view.subview(1), view);
+	ASSERT_GT(natural("7000000124000000000"), view);
+	ASSERT_EQ(view.subview(0, 1), natural(999999999u));
+
+	// kernels
+	const natural a("123456789123456789123456789");
+	ASSERT_EQ(view + a.view(), natural("123456796123456913123456788"));
+	ASSERT_EQ(view * view, natural("49000001736000015361999999752000000001"));
+	ASSERT_EQ(a.view() / view, natural("17636683"));
+	ASSERT_EQ(a.view() % view, a - natural("17636683") * natural(view));
+	ASSERT_EQ(a.view() - view, a - natural(view));
+
+	natural b = a;
+	b += view;
+	b -= view.subview(1);
+	ASSERT_EQ(b, a + natural(view) - natural("7000000123"));
+	b *= view.subview(0, 1);
+	b /= view.subview(0, 1);
+	ASSERT_EQ(b, a + natural(view) - natural("7000000123"));
+
+	// views into the operand itself
+	natural c = a;
+	c += c.view().subview(1);
+	ASSERT_EQ(c, a + (a >> 1));
+	c -= c.view().subview(2);
+	ASSERT_EQ(c, a + (a >> 1) - ((a + (a >> 1)) >> 2));
+	c *= c.view();
+	ASSERT_EQ(c, (a + (a >> 1) - ((a + (a >> 1)) >> 2)) * (a + (a >> 1) - ((a + (a >> 1)) >> 2)));
+
+	// output
+	std::ostringstream out;
+	out << view.subview(0, 2);
+	ASSERT_EQ(out.str(), "123999999999");
+}
+
+TEST(NaturalTestSuite, TestStreamingInput)
+{
+	using namespace big;
+
+	std::string digits = "000";
+	for (unsigned i = 0; i < 1000; ++i)
+	{
+		digits += static_cast<char>('0' + (i * 7 + 3) % 10);
+	}
+
+	const natural expected(digits);
+	ASSERT_EQ(expected.str(), digits.substr(3));
+
+	// chunks of every size, not aligned to the limbs
+	for (const std::size_t chunk_size : {1, 4, 9, 10, 1000})
+	{
+		std::size_t position = 0;
+		const auto next_chunk = [&]
+		{
+			const auto chunk = std::string_view(digits).substr(position, chunk_size);
+			position += std::ranges::size(chunk);
+			return chunk;
+		};
+
+		ASSERT_EQ(parse::parse_decimal(next_chunk), expected);
+	}
+
+	std::istringstream whole("  " + digits + "\n");
+	ASSERT_EQ(parse::parse_decimal(whole), expected);
+
+	std::istringstream trailing(digits + " 5");
+	ASSERT_THROW(static_cast<void>(parse::parse_decimal(trailing)), std::invalid_argument);
+	ASSERT_THROW(static_cast<void>(parse::parse_decimal([] { return std::string_view(); })), std::invalid_argument);
+
+	// stream extraction
+	std::istringstream in("123 000 1000000000,x");
+	natural a, b, c, d(7u);
+	in >> a >> b >> c;
+	ASSERT_EQ(a, natural(123u));
+	ASSERT_TRUE(b.is_zero());
+	ASSERT_EQ(c, natural(1000000000u));
+	ASSERT_EQ(in.get(), ',');
+	ASSERT_FALSE(in >> d);
+	ASSERT_EQ(d, natural(7u));
+
+	std::istringstream last("42");
+	ASSERT_TRUE(last >> d);
+	ASSERT_TRUE(last.eof());
+	ASSERT_EQ(d, natural(42u));
+}
+
+TEST(NaturalTestSuite, TestNaturalArray)
+{
+	using namespace big;
+
+	std::vector<natural> values;
+	for (unsigned i = 0; i < 200; ++i)
+	{
+		values.push_back(natural(i * 7919u % 1000u) * algorithm::pow(natural(1000000007u), natural(i % 9u)));
+	}
+
+	natural_array array(values);
+	ASSERT_EQ(array.size(), values.size());
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		ASSERT_EQ(array[i], values[i]);
+	}
+
+	ASSERT_EQ(array.at(3), values[3]);
+	ASSERT_THROW(static_cast<void>(array.at(values.size())), std::out_of_range);
+	ASSERT_EQ(std::ranges::distance(array), values.size());
+
+	// appending an element of the array itself
+	for (unsigned i = 0; i < 50; ++i)
+	{
+		array.push_back(array[i]);
+	}
+
+	ASSERT_EQ(array.back(), values[49]);
+	array.pop_back();
+	ASSERT_EQ(array.size(), values.size() + 49);
+	ASSERT_EQ(array.back(), values[48]);
+
+	// bulk sort
+	auto sorted = values;
+	sorted.insert(sorted.end(), values.begin(), values.begin() + 49);
+	std::ranges::sort(sorted);
+	array.sort();
+	ASSERT_TRUE(std::ranges::equal(array, sorted, [](natural_view lhs, const natural &rhs) { return lhs == rhs; }));
+
+	// element-wise arithmetic
+	std::vector<natural> others;
+	for (unsigned i = 0; i < 200; ++i)
+	{
+		others.push_back(natural(i + 1) * algorithm::pow(natural(999999937u), natural(i % 5u)) + natural(i % 3u == 0 ? 999999999u : 0u));
+	}
+
+	const natural_array lhs(values);
+	const natural_array rhs(others);
+	const auto sums = batch_add(lhs, rhs);
+	const auto products = batch_mul(lhs, rhs);
+	const auto remainders = batch_mod(lhs, rhs);
+	const auto differences = batch_sub(sums, rhs);
+
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		ASSERT_EQ(sums[i], values[i] + others[i]);
+		ASSERT_EQ(products[i], values[i] * others[i]);
+		ASSERT_EQ(remainders[i], values[i] % others[i]);
+		ASSERT_EQ(differences[i], values[i]);
+	}
+
+	ASSERT_THROW(static_cast<void>(batch_sub(lhs, sums)), std::domain_error);
+	ASSERT_THROW(static_cast<void>(batch_add(lhs, natural_array())), std::invalid_argument);
+	ASSERT_THROW(static_cast<void>(batch_mod(lhs, natural_array(std::vector<natural>(200)))), std::domain_error);
+
+	// large operands fall back to the Karatsuba multiplication
+	const natural_array large(std::vector<natural>{algorithm::pow(natural(3u), natural(3000u)), natural(0u)});
+	ASSERT_EQ(batch_mul(large, large)[0], algorithm::pow(natural(3u), natural(6000u)));
+	ASSERT_TRUE(batch_mul(large, large)[1].is_zero());
+}
+
+TEST(NaturalTestSuite, TestLimbBatch)
+{
+	using namespace big;
+
+	std::vector<natural> values;
+	std::vector<natural> others;
+	for (unsigned i = 0; i < 300; ++i)
+	{
+		values.push_back(algorithm::pow(natural(999999999u - i), natural(i % 3u + 1)));
+		others.push_back(algorithm::pow(natural(i * 104729u + 1), natural(i % 2u + 1)));
+	}
+
+	const limb_batch<3> lhs(values);
+	const limb_batch<2> rhs(others);
+	ASSERT_EQ(lhs.size(), values.size());
+	ASSERT_EQ(lhs[7], values[7]);
+
+	const auto sums = batch_add(lhs, rhs);
+	const auto products = batch_mul(lhs, rhs);
+	const auto remainders = batch_mod(lhs, rhs);
+	static_assert(decltype(sums)::limbs == 4 && decltype(products)::limbs == 5);
+
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		ASSERT_EQ(sums[i], values[i] + others[i]);
+		ASSERT_EQ(products[i], values[i] * others[i]);
+		ASSERT_EQ(remainders[i], values[i] % others[i]);
+	}
+
+	// single-limb divisors are divided in place
+	limb_batch<1> divisors(values.size());
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		divisors.store(i, natural(i + 2));
+	}
+
+	const auto small_remainders = batch_mod(lhs, divisors);
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		ASSERT_EQ(small_remainders[i], values[i] % natural(i + 2));
+	}
+
+	ASSERT_THROW(batch_mod(lhs, limb_batch<1>(values.size())), std::domain_error);
+	ASSERT_THROW(static_cast<void>(batch_add(lhs, limb_batch<2>())), std::invalid_argument);
+	ASSERT_THROW(limb_batch<1>().push_back(natural(1000000000u)), std::length_error);
+
+	// runtime limb counts are dispatched to the batches of the groups
+	const auto groups = group_by_limb_count(values);
+	ASSERT_EQ(groups[1].size() + groups[2].size() + groups[3].size(), values.size());
+
+	for (std::size_t limbs = 1; limbs <= 3; ++limbs)
+	{
+		const auto squares = with_limb_count(limbs, [&](auto count)
+		{
+			limb_batch<count> batch;
+			for (const auto index : groups[limbs])
+			{
+				batch.push_back(values[index]);
+			}
+
+			return batch_mul(batch, batch).size();
+		});
+
+		ASSERT_EQ(squares, groups[limbs].size());
+	}
+
+	ASSERT_THROW(with_limb_count(max_batch_limbs + 1, [](auto) {}), std::out_of_range);
+}
+
+TEST(NaturalTestSuite, TestConstantEvaluation)
+{
+	using namespace big;
+
+	static_assert([]
+	{
+		const natural a("123456789012345678901234567890");
+		const natural b("987654321987654321");
+		const auto [q, r] = a.long_div(b);
+		return q * b + r == a && r < b && q == natural(124999998748u);
+	}());
+	static_assert([]
+	{
+		natural a(10u);
+		a -= natural(3u);
+		a *= natural(7u);
+		a /= natural(2u);
+		a %= natural(20u);
+		a <<= 2;
+		return ++a == natural(4'000'000'000'000'000'001u);
+	}());
+	static_assert(algorithm::pow(natural(3u), 100u) % natural(1000u) == natural(1u));
+	static_assert(algorithm::gcd(natural(48u), natural(180u)) == natural(12u));
+
+	EXPECT_EQ(natural("000000000000123"), natural(123u));
+	EXPECT_THROW(natural("12a"), std::invalid_argument);
+}
+
+TEST(NaturalTestSuite, TestLiterals)
+{
+	using namespace big::literals;
+
+	static_assert(0_n == big::natural(0u));
+	static_assert(999'999'999_n == big::natural(999'999'999u));
+	static_assert((1'000'000'000_n).digits().size() == 2);
+	static_assert(123456789012345678901234567890_n % 1000000007_n == big::natural("123456789012345678901234567890") % big::natural(1000000007u));
+
+	EXPECT_EQ(123456789012345678901234567890_n, big::natural("123456789012345678901234567890"));
+	EXPECT_EQ((1'000'000'000'000'000'000'000_n).str(), "1000000000000000000000");
+
+	// the limbs of a literal are a constant, only they are copied when the number is created
+	EXPECT_EQ(std::ranges::size(big::literals::literals_detail::literal_limbs<'1', '2', '3', '4', '5', '6', '7', '8', '9', '0'>), 2);
+}
+
+TEST(NaturalTestSuite, TestFixedWidth)
+{
+	using namespace big;
+	using fixed = natural_fixed<4>;
+
+	static_assert(fixed_limbs(64) == 3);
+	static_assert(fixed_limbs(128) == 5);
+	static_assert(std::is_trivially_copyable_v<fixed>);
+	static_assert(sizeof(fixed) == 4 * sizeof(fixed::digit_type));
+	static_assert(noexcept(fixed() * fixed() / fixed(1u)));
+
+	static_assert(fixed(999'999'999u) + fixed(1u) == fixed(1'000'000'000u));
+	static_assert(fixed(0u) - fixed(1u) + fixed(1u) == fixed(0u));
+	static_assert(fixed(18446744073709551615ull) % fixed(1'000'000'007u) == fixed(18446744073709551615ull % 1'000'000'007u));
+	static_assert(algorithm::gcd(fixed(48u), fixed(180u)) == fixed(12u));
+	static_assert(algorithm::pow(fixed(3u), 40u) == fixed(12157665459056928801ull));
+
+	// against the arbitrary precision arithmetic
+	std::mt19937_64 gen(2024);
+	const auto random_natural = [&](std::size_t limbs)
+	{
+		natural::digits_type digits(limbs);
+		for (auto &digit : digits)
+		{
+			digit = static_cast<natural::digit_type>(gen() % natural::number_system_base);
+		}
+
+		return natural(std::move(digits));
+	};
+
+	const natural modulus = algorithm::pow(natural(natural::number_system_base), 4u);
+	for (int i = 0; i < 200; ++i)
+	{
+		const auto a = random_natural(1 + gen() % 4);
+		const auto b = random_natural(1 + gen() % 4);
+		if (b.is_zero())
+		{
+			continue;
+		}
+
+		const fixed fa(a);
+		const fixed fb(b);
+
+		EXPECT_EQ(natural((fa + fb).view()), (a + b) % modulus);
+		EXPECT_EQ(natural((fa * fb).view()), a * b % modulus);
+		EXPECT_EQ(natural((fa / fb).view()), a / b);
+		EXPECT_EQ(natural((fa % fb).view()), a % b);
+		EXPECT_EQ(fa <=> fb, a <=> b);
+
+		if (a >= b)
+		{
+			EXPECT_EQ(natural((fa - fb).view()), a - b);
+		}
+		else
+		{
+			EXPECT_EQ(natural((fa - fb).view()), modulus - (b - a));
+		}
+	}
+
+	// the limbs of a natural number are shared with the views of fixed numbers
+	fixed value(natural("123456789012345678901234567890"));
+	EXPECT_EQ(value.str(), "123456789012345678901234567890");
+	EXPECT_EQ(natural(7u) + value, natural("123456789012345678901234567897"));
+	EXPECT_EQ((value >> 1).str(), "123456789012345678901");
+	// the most significant limb is shifted out
+	EXPECT_EQ((value << 1).str(), "456789012345678901234567890000000000");
+	EXPECT_EQ(natural_fixed<2>(value).str(), "345678901234567890");
+	EXPECT_EQ(value.div_digit(10u), 0u);
+	EXPECT_EQ(value.str(), "12345678901234567890123456789");
+	EXPECT_EQ(algorithm::decimal_shift(fixed(5u), 20), fixed(natural("500000000000000000000")));
+}
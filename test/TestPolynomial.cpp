@@ -319,3 +319,34 @@ TEST(PolynomialTestSuite, PolynomialNmr)
 		ASSERT_TRUE(std::equal(cmp.coefficients().begin(), cmp.coefficients().end(), exp.begin(), exp.end()));
 	}
 }
+
+TEST(PolynomialTestSuite, PolynomialParallel)
+{
+	using namespace big;
+
+	std::vector<rational> first;
+	std::vector<rational> second;
+
+	for (int i = 0; i < 48; ++i)
+	{
+		first.emplace_back(i % 7 - 3, static_cast<unsigned>(i % 5 + 1));
+	}
+
+	for (int i = 0; i < 40; ++i)
+	{
+		second.emplace_back(i % 11 - 5, static_cast<unsigned>(i % 3 + 1));
+	}
+
+	const polynomial a(first);
+	const polynomial b(second);
+	const auto policy = execution::policy::with_threads(4);
+
+	polynomial product(a);
+	product.multiply(b, policy);
+	ASSERT_EQ(product.str(), (a * b).str());
+
+	const auto [quotient, remainder] = (product + a).long_div(b, policy);
+	ASSERT_EQ(quotient.str(), (product + a).long_div(b).first.str());
+	ASSERT_EQ(remainder.str(), (product + a).long_div(b).second.str());
+	ASSERT_EQ((quotient * b + remainder).str(), (product + a).str());
+}
@@ -1,5 +1,7 @@
 #include "../big/rational/rational.hpp"
 #include "../big/numeric/rational.hpp"
+#include "../big/parse/literals.hpp"
+#include <sstream>
 #include "gtest/gtest.h"
 
 TEST (RationalTestSuite, TestNumericRational)
@@ -382,3 +384,39 @@ TEST (RationalTestSuite, TestDivide)
 		ASSERT_EQ(c.denominator(), 34123);
 	}
 }
+
+TEST (RationalTestSuite, TestStreamInput)
+{
+	using namespace big;
+
+	std::istringstream in("-6/8 5 12345678901234567890/3 1/0");
+	rational a, b, c, d(1, 2u);
+	in >> a >> b >> c;
+	ASSERT_EQ(a, rational(-3, 4u));
+	ASSERT_EQ(b, rational(5));
+	ASSERT_EQ(c, rational(natural("4115226300411522630")));
+	ASSERT_FALSE(in >> d);
+	ASSERT_EQ(d, rational(1, 2u));
+
+	std::istringstream fraction("2/");
+	ASSERT_FALSE(fraction >> d);
+
+	std::istringstream last("-7/9");
+	ASSERT_TRUE(last >> d);
+	ASSERT_EQ(d.str(), "-7/9");
+}
+
+TEST (RationalTestSuite, TestLiterals)
+{
+	using namespace big;
+
+	static_assert("-22/8"_q == rational(-11, 4u));
+	static_assert("+6"_q == 6_q);
+	static_assert("-0/5"_q == 0_q);
+	static_assert(rational(1, 3u) + rational(-1, 6u) == "1/6"_q);
+
+	EXPECT_EQ("-22/8"_q, rational(-11, 4u));
+	EXPECT_EQ("-0/5"_q.numerator(), integer(0));
+	EXPECT_EQ(("123456789012345678901234567890/30"_q).str(), rational(natural("4115226300411522630041152263")).str());
+	EXPECT_EQ(7_q, rational(7));
+}
@@ -0,0 +1,376 @@
+#include <bit>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+#include "../big/conv/binary.hpp"
+#include "../big/conv/mapped_table.hpp"
+#include "../big/conv/decimal.hpp"
+#include "../big/parse/decimal.hpp"
+#include "../big/parse/bulk.hpp"
+#include "gtest/gtest.h"
+
+namespace
+{
+std::vector<std::byte> bytes(std::initializer_list<unsigned> values)
+{
+	std::vector<std::byte> result;
+	for (const auto value : values)
+	{
+		result.push_back(static_cast<std::byte>(value));
+	}
+
+	return result;
+}
+}
+
+TEST(SerializationTestSuite, TestRoundTrip)
+{
+	using namespace big;
+
+	const natural large("123456789012345678901234567890123456789012345678901234567890");
+	for (const auto &value : {natural(0u), natural(1u), natural(999999999u), large, large * large})
+	{
+		const auto data = conv::serialize(value);
+		ASSERT_EQ(data.size(), conv::serialized_size(value));
+		ASSERT_EQ(conv::deserialize<natural>(data), value);
+	}
+
+	for (const auto &value : {integer(0), integer(-7), integer(large, true), integer(large)})
+	{
+		ASSERT_EQ(conv::deserialize<integer>(conv::serialize(value)), value);
+	}
+
+	for (const auto &value : {rational(0), rational(-3, 7u), rational(integer(large), large + natural(1u))})
+	{
+		ASSERT_EQ(conv::deserialize<rational>(conv::serialize(value)).str(), value.str());
+	}
+
+	// the limbs are stored as they are
+	ASSERT_EQ(conv::serialize(natural(1000000005u)), bytes({1, 1, 2, 5, 0, 0, 0, 1, 0, 0, 0}));
+	ASSERT_EQ(conv::serialize(integer(-5)), bytes({1, 2, 1, 1, 5, 0, 0, 0}));
+
+	// the binary form is smaller than the decimal one
+	ASSERT_LT(conv::serialized_size(large * large), (large * large).str().size());
+}
+
+TEST(SerializationTestSuite, TestBuffersAndStreams)
+{
+	using namespace big;
+
+	const integer a(natural("98765432109876543210"), true);
+	const rational b(integer(5), natural(12u));
+
+	std::vector<std::byte> buffer(conv::serialized_size(a) + conv::serialized_size(b));
+	const auto written = conv::serialize(a, std::span(buffer));
+	ASSERT_EQ(conv::serialize(b, std::span(buffer).subspan(written)), conv::serialized_size(b));
+	ASSERT_THROW(conv::serialize(a, std::span(buffer).first(written - 1)), std::length_error);
+
+	std::size_t consumed = 0;
+	ASSERT_EQ(conv::deserialize<integer>(buffer, consumed), a);
+	ASSERT_EQ(consumed, written);
+	ASSERT_EQ(conv::deserialize<rational>(std::span(buffer).subspan(consumed)), b);
+
+	std::stringstream stream;
+	conv::serialize(a, stream);
+	conv::serialize(b, stream);
+	ASSERT_EQ(conv::deserialize<integer>(stream), a);
+	ASSERT_EQ(conv::deserialize<rational>(stream), b);
+	ASSERT_THROW(static_cast<void>(conv::deserialize<natural>(stream)), std::invalid_argument);
+}
+
+TEST(SerializationTestSuite, TestMalformedInput)
+{
+	using namespace big;
+
+	const auto data = conv::serialize(natural("1234567890123"));
+
+	// truncated, trailing bytes, wrong kind and version
+	ASSERT_THROW(static_cast<void>(conv::deserialize<natural>(std::span(data).first(data.size() - 1))), std::invalid_argument);
+	auto longer = data;
+	longer.push_back(std::byte{0});
+	ASSERT_THROW(static_cast<void>(conv::deserialize<natural>(longer)), std::invalid_argument);
+	ASSERT_THROW(static_cast<void>(conv::deserialize<integer>(data)), std::invalid_argument);
+	ASSERT_THROW(static_cast<void>(conv::deserialize<natural>(bytes({2, 1, 1, 0, 0, 0, 0}))), std::invalid_argument);
+
+	// invalid limbs, signs and denominators
+	ASSERT_THROW(static_cast<void>(conv::deserialize<natural>(bytes({1, 1, 0}))), std::invalid_argument);
+	ASSERT_THROW(static_cast<void>(conv::deserialize<natural>(bytes({1, 1, 1, 0, 0xCA, 0x9A, 0x3B}))), std::invalid_argument);
+	ASSERT_THROW(static_cast<void>(conv::deserialize<integer>(bytes({1, 2, 2, 1, 0, 0, 0, 0}))), std::invalid_argument);
+	ASSERT_THROW(static_cast<void>(conv::deserialize<rational>(bytes({1, 3, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0}))), std::invalid_argument);
+
+	// a huge limb count does not allocate before the input runs out
+	ASSERT_THROW(static_cast<void>(conv::deserialize<natural>(bytes({1, 1, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F}))), std::invalid_argument);
+
+	// negative zero is normalized
+	ASSERT_FALSE(conv::deserialize<integer>(bytes({1, 2, 1, 1, 0, 0, 0, 0})).sign_bit());
+}
+
+TEST(SerializationTestSuite, TestImportExport)
+{
+	using namespace big;
+
+	const auto data = bytes({0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08});
+
+	ASSERT_EQ(conv::import_bytes(data), natural(0x0102030405060708u));
+	ASSERT_EQ(conv::import_bytes(data, 1, conv::word_order::least_significant_first), natural(0x0807060504030201u));
+	ASSERT_EQ(conv::import_bytes(data, 4, conv::word_order::least_significant_first, std::endian::big), natural(0x0506070801020304u));
+	ASSERT_EQ(conv::import_bytes(data, 2, conv::word_order::most_significant_first, std::endian::little), natural(0x0201040306050807u));
+	ASSERT_TRUE(conv::import_bytes({}).is_zero());
+	ASSERT_THROW(static_cast<void>(conv::import_bytes(data, 3)), std::invalid_argument);
+	ASSERT_THROW(static_cast<void>(conv::import_bytes(data, 0)), std::invalid_argument);
+
+	ASSERT_EQ(conv::export_bytes(natural(0x0102030405060708u)), data);
+	ASSERT_EQ(conv::export_bytes(natural(0x0506070801020304u), 4, conv::word_order::least_significant_first, std::endian::big), data);
+	ASSERT_EQ(conv::export_bytes(natural(0x0201040306050807u), 2, conv::word_order::most_significant_first, std::endian::little), data);
+	ASSERT_EQ(conv::export_bytes(natural(0x10203u), 4), bytes({0, 1, 2, 3}));
+	ASSERT_TRUE(conv::export_bytes(natural(0u)).empty());
+
+	// large numbers are split at powers of 256
+	natural large("1");
+	for (unsigned i = 0; i < 40; ++i)
+	{
+		large *= natural("1844674407370955161718446744073709551617");
+	}
+
+	for (const std::size_t word_size : {1, 3, 8})
+	{
+		const auto exported = conv::export_bytes(large, word_size, conv::word_order::least_significant_first, std::endian::little);
+		ASSERT_GT(exported.size(), 600);
+		ASSERT_EQ(conv::import_bytes(exported, word_size, conv::word_order::least_significant_first, std::endian::little), large);
+	}
+
+	ASSERT_EQ(conv::import_bytes(conv::export_bytes(large)), large);
+}
+
+TEST(SerializationTestSuite, TestMappedTable)
+{
+	using namespace big;
+
+	const auto directory = std::filesystem::temp_directory_path();
+	const auto naturals_path = directory / "bigmath_naturals.tbl";
+	const auto rationals_path = directory / "bigmath_rationals.tbl";
+
+	std::vector<natural> naturals{natural("123456789012345678901234567890")};
+	for (unsigned i = 0; i < 100; ++i)
+	{
+		naturals.push_back(naturals.back() * natural(i + 2));
+	}
+
+	naturals.emplace_back(0u);
+
+	conv::write_table<natural>(naturals_path, naturals);
+
+	{
+		const conv::mapped_table<natural> table(naturals_path);
+		ASSERT_EQ(table.size(), naturals.size());
+		table.verify();
+
+		for (std::size_t i = 0; i < naturals.size(); ++i)
+		{
+			ASSERT_EQ(table.view(i), naturals[i]);
+			ASSERT_FALSE(table.sign_bit(i));
+		}
+
+		ASSERT_EQ(table[57], naturals[57]);
+		ASSERT_EQ(table.view(1) + table.view(2), naturals[1] + naturals[2]);
+		ASSERT_THROW(static_cast<void>(table.view(naturals.size())), std::out_of_range);
+
+		// the limbs are viewed in place, aligned for vector loads
+		ASSERT_EQ(reinterpret_cast<std::uintptr_t>(table.view(0).digits().data()) % 64, 0);
+		ASSERT_EQ(table.view(2).digits().data(), table.view(1).digits().data() + table.view(1).size());
+	}
+
+	const std::vector<rational> rationals{rational(0), rational(-3, 7u), rational(integer(naturals[5], true), naturals[9] + natural(1u))};
+	conv::write_table<rational>(rationals_path, rationals);
+
+	{
+		const conv::mapped_table<rational> table(rationals_path);
+		ASSERT_EQ(table.size(), rationals.size());
+		table.verify();
+
+		for (std::size_t i = 0; i < rationals.size(); ++i)
+		{
+			ASSERT_EQ(table[i].str(), rationals[i].str());
+		}
+
+		ASSERT_TRUE(table.sign_bit(1));
+		ASSERT_EQ(table.view(1, 1), natural(7u));
+
+		// tables of other kinds are rejected
+		ASSERT_THROW(conv::mapped_table<natural>{rationals_path}, std::invalid_argument);
+	}
+
+	conv::write_table<integer>(rationals_path, std::vector<integer>{});
+	ASSERT_TRUE(conv::mapped_table<integer>(rationals_path).empty());
+
+	{
+		// a corrupted header claiming as many naturals as the offsets can count
+		std::fstream file(naturals_path, std::ios::in | std::ios::out | std::ios::binary);
+		const auto numbers = std::numeric_limits<std::uint64_t>::max();
+		file.seekp(offsetof(conv::detail::table_header, count));
+		file.write(reinterpret_cast<const char *>(&numbers), sizeof(numbers));
+		file.write(reinterpret_cast<const char *>(&numbers), sizeof(numbers));
+	}
+	ASSERT_THROW(conv::mapped_table<natural>{naturals_path}, std::invalid_argument);
+
+	std::filesystem::resize_file(naturals_path, 100);
+	ASSERT_THROW(conv::mapped_table<natural>{naturals_path}, std::invalid_argument);
+	ASSERT_THROW(conv::mapped_table<natural>{directory / "bigmath_missing.tbl"}, std::system_error);
+
+	std::filesystem::remove(naturals_path);
+	std::filesystem::remove(rationals_path);
+}
+
+TEST(SerializationTestSuite, TestDecimalOutput)
+{
+	using namespace big;
+
+	const natural value("12345678900000000100000000000000000987654321");
+	const auto text = value.str();
+	ASSERT_EQ(conv::decimal_size(value), text.size());
+	ASSERT_EQ(conv::decimal_size(natural(0u)), 1);
+	ASSERT_EQ(natural(0u).str(), "0");
+
+	// any range of the digits can be formatted on its own
+	for (std::size_t first = 0; first < text.size(); first += 5)
+	{
+		for (std::size_t count = 0; first + count <= text.size(); count += 7)
+		{
+			std::string range(count, ' ');
+			conv::format_decimal(value, first, count, range.data());
+			ASSERT_EQ(range, text.substr(first, count));
+		}
+	}
+
+	std::string iterated;
+	conv::write_decimal(value, std::back_inserter(iterated));
+	ASSERT_EQ(iterated, text);
+
+	std::ostringstream padded;
+	padded << std::setw(8) << std::setfill('*') << natural(42u) << ' ' << std::left << std::setw(4) << natural(7u) << natural(5u);
+	ASSERT_EQ(padded.str(), "******42 7***5");
+
+	// several blocks written in parallel rounds to a file descriptor
+	natural::digits_type limbs(300000);
+	for (std::size_t i = 0; i < limbs.size(); ++i)
+	{
+		limbs[i] = static_cast<natural::digit_type>(i * 7919 % natural::number_system_base);
+	}
+
+	limbs.back() = 12345;
+	const natural huge(std::move(limbs));
+
+	const auto path = std::filesystem::temp_directory_path() / "bigmath_digits.txt";
+	for (const auto &policy : {execution::seq, execution::policy::with_threads(3)})
+	{
+		const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+		ASSERT_GE(fd, 0);
+		conv::write_decimal(huge, fd, policy);
+		::close(fd);
+
+		std::ifstream in(path);
+		ASSERT_EQ(parse::parse_decimal(in), huge);
+		ASSERT_EQ(std::filesystem::file_size(path), conv::decimal_size(huge));
+	}
+
+	std::filesystem::remove(path);
+}
+
+TEST(SerializationTestSuite, TestBulkLoad)
+{
+	using namespace big;
+
+	{
+		std::string text;
+		std::vector<natural> expected;
+		std::vector<parse::malformed_field> errors;
+
+		natural value("98765432109876543210");
+		for (std::size_t line = 1; line <= 30000; ++line)
+		{
+			if (line % 997 == 0)
+			{
+				errors.push_back({line, std::ranges::size(text), "invalid number, one or more characters are not a digit"});
+				text += "12x4\n";
+				continue;
+			}
+
+			if (line % 1009 == 0)
+			{
+				text += "  \r\n";
+				continue;
+			}
+
+			value = line % 100 == 0 ? natural(line) : value * natural(3u) + natural(line);
+			text += value.str() + (line % 2 == 0 ? "\r\n" : "\n");
+			expected.push_back(value);
+		}
+
+		ASSERT_GT(std::ranges::size(text), 4 * parse::detail::min_bulk_chunk);
+
+		for (const auto &policy : {execution::seq, execution::policy::with_threads(3)})
+		{
+			const parse::bulk_numbers<natural> numbers(text, ',', policy);
+
+			ASSERT_EQ(numbers.size(), std::ranges::size(expected));
+			for (std::size_t i = 0; i < numbers.size(); ++i)
+			{
+				ASSERT_EQ(numbers.view(i), expected[i]);
+			}
+
+			EXPECT_EQ(numbers.errors(), errors);
+		}
+
+		const auto path = std::filesystem::temp_directory_path() / "bigmath_bulk.txt";
+		std::ofstream(path, std::ios::binary) << text;
+
+		const auto loaded = parse::load_numbers<natural>(path, ',', execution::policy::with_threads(4));
+		EXPECT_EQ(loaded.size(), std::ranges::size(expected));
+		EXPECT_EQ(loaded[loaded.size() - 1], expected.back());
+		EXPECT_EQ(loaded.errors(), errors);
+
+		std::filesystem::remove(path);
+	}
+	{
+		const parse::bulk_numbers<integer> numbers(" -12, +7 ,0\n-0,;,\n\n123456789012345678901234567890,-\n");
+
+		ASSERT_EQ(numbers.size(), 5);
+		EXPECT_EQ(numbers[0], integer(-12));
+		EXPECT_EQ(numbers[1], integer(7));
+		EXPECT_EQ(numbers[3], integer(0));
+		EXPECT_FALSE(numbers.sign_bit(3));
+		EXPECT_EQ(numbers[4], integer(natural("123456789012345678901234567890")));
+
+		const std::vector<parse::malformed_field> errors{
+			{2, 15, "invalid number, one or more characters are not a digit"},
+			{2, 17, "empty field"},
+			{4, 50, "invalid number, one or more characters are not a digit"},
+		};
+		EXPECT_EQ(numbers.errors(), errors);
+	}
+	{
+		const parse::bulk_numbers<rational> numbers("6/4\t-3\t1/0\t/2\n-10/15\t0/7\t1/\t5/ \n", '\t');
+
+		ASSERT_EQ(numbers.size(), 4);
+		EXPECT_EQ(numbers[0], rational(3, 2u));
+		EXPECT_EQ(numbers[1], rational(-3));
+		EXPECT_EQ(numbers[2], rational(-2, 3u));
+		EXPECT_EQ(numbers[3], rational(0));
+		EXPECT_EQ(numbers.view(2, 1), natural(15u));
+
+		ASSERT_EQ(std::ranges::size(numbers.errors()), 4);
+		EXPECT_EQ(numbers.errors()[0].reason, "denominator is zero");
+		EXPECT_EQ(numbers.errors()[1].offset, 11);
+
+		// a slash without a denominator is not a whole number
+		const std::vector<parse::malformed_field> empty_denominators{
+			{2, 25, "empty denominator"},
+			{2, 28, "empty denominator"},
+		};
+		EXPECT_EQ(std::vector(numbers.errors().begin() + 2, numbers.errors().end()), empty_denominators);
+	}
+}